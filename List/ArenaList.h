@@ -0,0 +1,983 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+// Doubly linked list whose nodes live in one contiguous, growable array and link
+// to each other by 32-bit slot indices. A node costs 12 bytes of links and
+// generation on top of the value, with no per-node heap block.
+//
+// Erased slots go on a free list and are reused by later insertions. Every slot
+// carries a generation that changes whenever it is filled or freed, so a handle
+// (array id + slot index + generation) taken from an element can be kept outside
+// the list and later used for O(1) lookup or erase, and is detected as stale once
+// its element has been erased. The array id keeps a handle from matching a slot
+// of another array the list adopts by swap, move or copy assignment.
+//
+// Iterators and handles hold indices, not addresses, so they stay valid when the
+// array grows; references and pointers to elements do not. Iterators also hold
+// the ArenaList they came from and become invalid after a swap or a move, while
+// handles follow their elements into the other list.
+template <typename T, typename Alloc = std::allocator<T>>
+class ArenaList
+{
+
+public:
+
+	using allocator_type = Alloc;
+
+	class handle
+	{
+	private:
+		uint32_t _arena;
+		uint32_t _index;
+		uint32_t _generation;
+
+		handle(uint32_t arena, uint32_t index, uint32_t generation);
+
+	public:
+		// A default-constructed handle never refers to an element.
+		handle();
+
+		bool operator==(const handle& other) const = default;
+
+		friend class ArenaList;
+	};
+
+private:
+
+#pragma region Slot
+
+	static constexpr uint32_t npos = std::numeric_limits<uint32_t>::max();
+
+	// Live slots have an odd generation, free slots an even one. Free slots are
+	// chained through _next.
+	struct Slot
+	{
+		uint32_t _next;
+		uint32_t _prev;
+		uint32_t _generation;
+
+		union
+		{
+			T _val;
+		};
+
+		Slot();
+		~Slot();
+	};
+
+	using AllocTraits = std::allocator_traits<Alloc>;
+	using SlotAlloc = typename AllocTraits::template rebind_alloc<Slot>;
+	using SlotTraits = std::allocator_traits<SlotAlloc>;
+
+	static bool is_live(const Slot& slot);
+	static uint32_t next_arena();
+
+	template <typename... Args>
+	uint32_t create_slot(Args&&... args);
+	template <typename... Args>
+	uint32_t fill_slot(Args&&... args);
+	void release_slot(uint32_t index);
+	void link_before(uint32_t index, uint32_t pos);
+	void unlink(uint32_t index);
+	void grow(size_t capacity);
+	void swap_slots(ArenaList& other) noexcept;
+
+	[[no_unique_address]] SlotAlloc _alloc;
+	Slot* _slots;
+	uint32_t _capacity;
+	uint32_t _used;
+	uint32_t _head;
+	uint32_t _tail;
+	uint32_t _free;
+	// Id of the slot array, carried by handles. It moves with the array on swap and
+	// move, and a new array gets a new id.
+	uint32_t _arena;
+	size_t _size;
+
+#pragma endregion
+
+public:
+
+#pragma region Iterator
+
+	class iterator
+	{
+	public:
+		using value_type = T;
+		using difference_type = std::ptrdiff_t;
+		using pointer = T*;
+		using reference = T&;
+		using iterator_category = std::bidirectional_iterator_tag;
+
+	private:
+		ArenaList* _list;
+		uint32_t _index;
+
+	public:
+		iterator(ArenaList* list = nullptr, uint32_t index = npos);
+
+		reference operator*() const;
+		pointer operator->() const;
+		iterator& operator++();
+		iterator operator++(int);
+		iterator& operator--();
+		iterator operator--(int);
+		bool operator==(const iterator& other) const;
+		bool operator!=(const iterator& other) const;
+
+		friend class const_iterator;
+		friend class ArenaList;
+	};
+
+	static_assert(std::bidirectional_iterator<iterator>);
+
+#pragma endregion
+
+#pragma region Const Iterator
+
+	class const_iterator
+	{
+	public:
+		using value_type = T;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const T*;
+		using reference = const T&;
+		using iterator_category = std::bidirectional_iterator_tag;
+
+	private:
+		const ArenaList* _list;
+		uint32_t _index;
+
+	public:
+		const_iterator(const ArenaList* list = nullptr, uint32_t index = npos);
+		const_iterator(const iterator& iter);
+
+		reference operator*() const;
+		pointer operator->() const;
+		const_iterator& operator++();
+		const_iterator operator++(int);
+		const_iterator& operator--();
+		const_iterator operator--(int);
+		bool operator==(const const_iterator& other) const;
+		bool operator!=(const const_iterator& other) const;
+
+		friend class ArenaList;
+	};
+
+	static_assert(std::bidirectional_iterator<const_iterator>);
+
+#pragma endregion
+
+	using reverse_iterator = std::reverse_iterator<iterator>;
+	using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+	ArenaList() noexcept(noexcept(Alloc()));
+	explicit ArenaList(const Alloc& alloc) noexcept;
+	ArenaList(std::initializer_list<T> initList, const Alloc& alloc = Alloc());
+	template <std::input_iterator iter>
+	ArenaList(iter begin, iter end, const Alloc& alloc = Alloc());
+	ArenaList(const ArenaList& other);
+	ArenaList(ArenaList&& other) noexcept;
+	~ArenaList();
+
+	allocator_type get_allocator() const;
+
+	bool empty() const noexcept;
+	size_t size() const noexcept;
+	size_t capacity() const noexcept;
+	T& front();
+	const T& front() const;
+	T& back();
+	const T& back() const;
+	void clear();
+	void reserve(size_t count);
+
+	void push_front(const T& val);
+	void push_back(const T& val);
+	template <typename... Args>
+	handle emplace_front(Args&&... args);
+	template <typename... Args>
+	handle emplace_back(Args&&... args);
+	void pop_front();
+	void pop_back();
+	template <typename... Args>
+	iterator emplace(const const_iterator& pos, Args&&... args);
+	iterator insert(const const_iterator& pos, const T& val);
+	iterator insert(const const_iterator& pos, T&& val);
+	iterator erase(const const_iterator& pos);
+	bool erase(const handle& h);
+	void swap(ArenaList& other);
+
+	handle handle_of(const const_iterator& pos) const;
+	bool contains(const handle& h) const;
+	T* get(const handle& h);
+	const T* get(const handle& h) const;
+	iterator find(const handle& h);
+	const_iterator find(const handle& h) const;
+
+	iterator begin();
+	iterator end();
+	const_iterator begin() const;
+	const_iterator end() const;
+	const_iterator cbegin() const;
+	const_iterator cend() const;
+	reverse_iterator rbegin();
+	reverse_iterator rend();
+	const_reverse_iterator rbegin() const;
+	const_reverse_iterator rend() const;
+	const_reverse_iterator crbegin() const;
+	const_reverse_iterator crend() const;
+
+	ArenaList& operator=(const ArenaList& other);
+	ArenaList& operator=(ArenaList&& other) noexcept(AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value);
+
+	template <typename U, typename A>
+	friend bool operator==(const ArenaList<U, A>& lhs, const ArenaList<U, A>& rhs);
+
+};
+
+#pragma region CtorsAndDestructors
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::ArenaList() noexcept(noexcept(Alloc())) : ArenaList(Alloc()) { }
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::ArenaList(const Alloc& alloc) noexcept
+	: _alloc(alloc), _slots(nullptr), _capacity(0), _used(0), _head(npos), _tail(npos), _free(npos), _arena(next_arena()), _size(0) { }
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::ArenaList(std::initializer_list<T> initList, const Alloc& alloc)
+	: ArenaList(initList.begin(), initList.end(), alloc) { }
+
+template<typename T, typename Alloc>
+template<std::input_iterator iter>
+ArenaList<T, Alloc>::ArenaList(iter begin, iter end, const Alloc& alloc) : ArenaList(alloc)
+{
+	if constexpr (std::forward_iterator<iter>)
+		reserve(std::distance(begin, end));
+
+	for (auto it = begin; it != end; ++it)
+		emplace_back(*it);
+}
+
+// The copy is compact: elements occupy slots 0..size()-1 in list order.
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::ArenaList(const ArenaList& other)
+	: ArenaList(other.begin(), other.end(), AllocTraits::select_on_container_copy_construction(other.get_allocator())) { }
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::ArenaList(ArenaList&& other) noexcept : ArenaList(other.get_allocator())
+{
+	swap_slots(other);
+}
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::~ArenaList()
+{
+	clear();
+
+	if (_slots != nullptr)
+		SlotTraits::deallocate(_alloc, _slots, _capacity);
+}
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::allocator_type ArenaList<T, Alloc>::get_allocator() const
+{
+	return allocator_type(_alloc);
+}
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::handle::handle() : _arena(0), _index(npos), _generation(0) { }
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::handle::handle(uint32_t arena, uint32_t index, uint32_t generation) : _arena(arena), _index(index), _generation(generation) { }
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::Slot::Slot() : _next(npos), _prev(npos), _generation(0) { }
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::Slot::~Slot() { }
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::iterator::iterator(ArenaList* list, uint32_t index) : _list(list), _index(index) { }
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::const_iterator::const_iterator(const ArenaList* list, uint32_t index) : _list(list), _index(index) { }
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::const_iterator::const_iterator(const iterator& iter) : _list(iter._list), _index(iter._index) { }
+
+#pragma endregion
+
+#pragma region Slot
+
+template<typename T, typename Alloc>
+bool ArenaList<T, Alloc>::is_live(const Slot& slot)
+{
+	return slot._generation % 2 == 1;
+}
+
+// Ids only need to differ between the arrays a handle could be checked against;
+// after 2^32 arrays of one element type they repeat.
+template<typename T, typename Alloc>
+uint32_t ArenaList<T, Alloc>::next_arena()
+{
+	static std::atomic<uint32_t> last = 0;
+	return ++last;
+}
+
+// Takes a slot from the free list or the unused tail of the array and constructs
+// the value in it. The slot is not linked yet.
+template<typename T, typename Alloc>
+template<typename... Args>
+uint32_t ArenaList<T, Alloc>::create_slot(Args&&... args)
+{
+	if (_free != npos || _used != _capacity)
+		return fill_slot(std::forward<Args>(args)...);
+
+	// Growing moves every element, and args may refer to one of them, so the
+	// value is built before the array moves.
+	T val(std::forward<Args>(args)...);
+	grow(_capacity == 0 ? 8 : size_t(_capacity) * 2);
+	return fill_slot(std::move(val));
+}
+
+template<typename T, typename Alloc>
+template<typename... Args>
+uint32_t ArenaList<T, Alloc>::fill_slot(Args&&... args)
+{
+	uint32_t index = _free != npos ? _free : _used;
+	Slot& slot = _slots[index];
+	if (index == _used)
+		::new (static_cast<void*>(&slot)) Slot();
+
+	SlotTraits::construct(_alloc, std::addressof(slot._val), std::forward<Args>(args)...);
+
+	if (index == _used)
+		++_used;
+	else
+		_free = slot._next;
+
+	++slot._generation;
+	return index;
+}
+
+// Destroys the value of an unlinked slot and puts the slot on the free list.
+template<typename T, typename Alloc>
+void ArenaList<T, Alloc>::release_slot(uint32_t index)
+{
+	Slot& slot = _slots[index];
+	SlotTraits::destroy(_alloc, std::addressof(slot._val));
+
+	++slot._generation;
+	slot._prev = npos;
+	slot._next = _free;
+	_free = index;
+}
+
+// Links a filled slot in front of pos; pos == npos links it at the back.
+template<typename T, typename Alloc>
+void ArenaList<T, Alloc>::link_before(uint32_t index, uint32_t pos)
+{
+	uint32_t prev = pos == npos ? _tail : _slots[pos]._prev;
+
+	_slots[index]._next = pos;
+	_slots[index]._prev = prev;
+	(prev == npos ? _head : _slots[prev]._next) = index;
+	(pos == npos ? _tail : _slots[pos]._prev) = index;
+
+	++_size;
+}
+
+template<typename T, typename Alloc>
+void ArenaList<T, Alloc>::unlink(uint32_t index)
+{
+	uint32_t next = _slots[index]._next;
+	uint32_t prev = _slots[index]._prev;
+
+	(prev == npos ? _head : _slots[prev]._next) = next;
+	(next == npos ? _tail : _slots[next]._prev) = prev;
+
+	--_size;
+}
+
+// Moves every used slot into a larger array. Values move only if that cannot
+// throw, so a failed growth leaves the list unchanged.
+template<typename T, typename Alloc>
+void ArenaList<T, Alloc>::grow(size_t capacity)
+{
+	if (capacity >= npos)
+	{
+		if (_capacity + size_t(1) >= npos)
+			throw std::length_error("ArenaList exceeds 2^32 - 1 slots");
+
+		capacity = npos - 1;
+	}
+
+	Slot* slots = SlotTraits::allocate(_alloc, capacity);
+	uint32_t moved = 0;
+	try
+	{
+		for (; moved < _used; ++moved)
+		{
+			Slot& from = _slots[moved];
+			Slot* to = ::new (static_cast<void*>(slots + moved)) Slot();
+			to->_next = from._next;
+			to->_prev = from._prev;
+			to->_generation = from._generation;
+
+			if (is_live(from))
+				SlotTraits::construct(_alloc, std::addressof(to->_val), std::move_if_noexcept(from._val));
+		}
+	}
+	catch (...)
+	{
+		for (uint32_t i = 0; i < moved; ++i)
+		{
+			if (is_live(slots[i]))
+				SlotTraits::destroy(_alloc, std::addressof(slots[i]._val));
+		}
+
+		SlotTraits::deallocate(_alloc, slots, capacity);
+		throw;
+	}
+
+	for (uint32_t i = 0; i < _used; ++i)
+	{
+		if (is_live(_slots[i]))
+			SlotTraits::destroy(_alloc, std::addressof(_slots[i]._val));
+	}
+
+	if (_slots != nullptr)
+		SlotTraits::deallocate(_alloc, _slots, _capacity);
+
+	_slots = slots;
+	_capacity = static_cast<uint32_t>(capacity);
+}
+
+template<typename T, typename Alloc>
+void ArenaList<T, Alloc>::swap_slots(ArenaList& other) noexcept
+{
+	std::swap(_slots, other._slots);
+	std::swap(_capacity, other._capacity);
+	std::swap(_used, other._used);
+	std::swap(_head, other._head);
+	std::swap(_tail, other._tail);
+	std::swap(_free, other._free);
+	std::swap(_arena, other._arena);
+	std::swap(_size, other._size);
+}
+
+#pragma endregion
+
+#pragma region GetElement
+
+template<typename T, typename Alloc>
+bool ArenaList<T, Alloc>::empty() const noexcept
+{
+	return _size == 0;
+}
+
+template<typename T, typename Alloc>
+size_t ArenaList<T, Alloc>::size() const noexcept
+{
+	return _size;
+}
+
+template<typename T, typename Alloc>
+size_t ArenaList<T, Alloc>::capacity() const noexcept
+{
+	return _capacity;
+}
+
+template<typename T, typename Alloc>
+T& ArenaList<T, Alloc>::front()
+{
+	return _slots[_head]._val;
+}
+
+template<typename T, typename Alloc>
+const T& ArenaList<T, Alloc>::front() const
+{
+	return _slots[_head]._val;
+}
+
+template<typename T, typename Alloc>
+T& ArenaList<T, Alloc>::back()
+{
+	return _slots[_tail]._val;
+}
+
+template<typename T, typename Alloc>
+const T& ArenaList<T, Alloc>::back() const
+{
+	return _slots[_tail]._val;
+}
+
+#pragma endregion
+
+#pragma region Handles
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::handle ArenaList<T, Alloc>::handle_of(const const_iterator& pos) const
+{
+	return handle(_arena, pos._index, _slots[pos._index]._generation);
+}
+
+template<typename T, typename Alloc>
+bool ArenaList<T, Alloc>::contains(const handle& h) const
+{
+	return h._arena == _arena && h._index < _used && _slots[h._index]._generation == h._generation && is_live(_slots[h._index]);
+}
+
+// Returns nullptr for a stale handle.
+template<typename T, typename Alloc>
+T* ArenaList<T, Alloc>::get(const handle& h)
+{
+	return contains(h) ? std::addressof(_slots[h._index]._val) : nullptr;
+}
+
+template<typename T, typename Alloc>
+const T* ArenaList<T, Alloc>::get(const handle& h) const
+{
+	return contains(h) ? std::addressof(_slots[h._index]._val) : nullptr;
+}
+
+// Returns end() for a stale handle.
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::iterator ArenaList<T, Alloc>::find(const handle& h)
+{
+	return iterator(this, contains(h) ? h._index : npos);
+}
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::const_iterator ArenaList<T, Alloc>::find(const handle& h) const
+{
+	return const_iterator(this, contains(h) ? h._index : npos);
+}
+
+#pragma endregion
+
+#pragma region Xary
+
+// Every slot is freed, but the array is kept and generations keep counting, so
+// handles taken before clear() stay detectably stale.
+template<typename T, typename Alloc>
+void ArenaList<T, Alloc>::clear()
+{
+	while (_head != npos)
+	{
+		uint32_t index = _head;
+		_head = _slots[index]._next;
+		release_slot(index);
+	}
+
+	_tail = npos;
+	_size = 0;
+}
+
+template<typename T, typename Alloc>
+void ArenaList<T, Alloc>::reserve(size_t count)
+{
+	if (count > _capacity)
+		grow(count);
+}
+
+template<typename T, typename Alloc>
+void ArenaList<T, Alloc>::push_front(const T& val)
+{
+	emplace_front(val);
+}
+
+template<typename T, typename Alloc>
+void ArenaList<T, Alloc>::push_back(const T& val)
+{
+	emplace_back(val);
+}
+
+template<typename T, typename Alloc>
+template<typename... Args>
+ArenaList<T, Alloc>::handle ArenaList<T, Alloc>::emplace_front(Args&&... args)
+{
+	uint32_t index = create_slot(std::forward<Args>(args)...);
+	link_before(index, _head);
+	return handle(_arena, index, _slots[index]._generation);
+}
+
+template<typename T, typename Alloc>
+template<typename... Args>
+ArenaList<T, Alloc>::handle ArenaList<T, Alloc>::emplace_back(Args&&... args)
+{
+	uint32_t index = create_slot(std::forward<Args>(args)...);
+	link_before(index, npos);
+	return handle(_arena, index, _slots[index]._generation);
+}
+
+template<typename T, typename Alloc>
+void ArenaList<T, Alloc>::pop_front()
+{
+	if (_head != npos)
+		erase(begin());
+}
+
+template<typename T, typename Alloc>
+void ArenaList<T, Alloc>::pop_back()
+{
+	if (_tail != npos)
+		erase(const_iterator(this, _tail));
+}
+
+template<typename T, typename Alloc>
+template<typename... Args>
+ArenaList<T, Alloc>::iterator ArenaList<T, Alloc>::emplace(const const_iterator& pos, Args&&... args)
+{
+	uint32_t index = create_slot(std::forward<Args>(args)...);
+	link_before(index, pos._index);
+	return iterator(this, index);
+}
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::iterator ArenaList<T, Alloc>::insert(const const_iterator& pos, const T& val)
+{
+	return emplace(pos, val);
+}
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::iterator ArenaList<T, Alloc>::insert(const const_iterator& pos, T&& val)
+{
+	return emplace(pos, std::move(val));
+}
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::iterator ArenaList<T, Alloc>::erase(const const_iterator& pos)
+{
+	uint32_t next = _slots[pos._index]._next;
+
+	unlink(pos._index);
+	release_slot(pos._index);
+
+	return iterator(this, next);
+}
+
+// Returns false, and does nothing, for a stale handle.
+template<typename T, typename Alloc>
+bool ArenaList<T, Alloc>::erase(const handle& h)
+{
+	if (!contains(h))
+		return false;
+
+	unlink(h._index);
+	release_slot(h._index);
+	return true;
+}
+
+template<typename T, typename Alloc>
+void ArenaList<T, Alloc>::swap(ArenaList& other)
+{
+	if constexpr (AllocTraits::propagate_on_container_swap::value)
+	{
+		using std::swap;
+		swap(_alloc, other._alloc);
+	}
+
+	swap_slots(other);
+}
+
+#pragma endregion
+
+#pragma region Operators
+
+template<typename T, typename Alloc>
+bool operator==(const ArenaList<T, Alloc>& lhs, const ArenaList<T, Alloc>& rhs)
+{
+	if (lhs._size != rhs._size)
+		return false;
+
+	auto rhsIter = rhs.begin();
+	for (const T& val : lhs)
+	{
+		if (!(val == *rhsIter))
+			return false;
+
+		++rhsIter;
+	}
+
+	return true;
+}
+
+template<typename T, typename Alloc>
+bool operator!=(const ArenaList<T, Alloc>& lhs, const ArenaList<T, Alloc>& rhs)
+{
+	return !(lhs == rhs);
+}
+
+template<typename T, typename Alloc>
+void swap(ArenaList<T, Alloc>& lhs, ArenaList<T, Alloc>& rhs)
+{
+	lhs.swap(rhs);
+}
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>& ArenaList<T, Alloc>::operator=(const ArenaList& other)
+{
+	if (this == &other) return *this;
+
+	clear();
+
+	if constexpr (AllocTraits::propagate_on_container_copy_assignment::value)
+	{
+		if (_alloc != other._alloc)
+		{
+			if (_slots != nullptr)
+				SlotTraits::deallocate(_alloc, _slots, _capacity);
+
+			_slots = nullptr;
+			_capacity = _used = 0;
+			_free = npos;
+			_arena = next_arena();
+		}
+
+		_alloc = other._alloc;
+	}
+
+	for (const T& val : other)
+		emplace_back(val);
+
+	return *this;
+}
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>& ArenaList<T, Alloc>::operator=(ArenaList&& other) noexcept(AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value)
+{
+	if (this == &other) return *this;
+
+	if constexpr (!AllocTraits::propagate_on_container_move_assignment::value)
+	{
+		if (!AllocTraits::is_always_equal::value && _alloc != other._alloc)
+		{
+			clear();
+			for (T& val : other)
+				emplace_back(std::move(val));
+
+			other.clear();
+			return *this;
+		}
+	}
+
+	// The old array goes to other, which releases it with the allocator that
+	// other ends up holding.
+	clear();
+
+	if constexpr (AllocTraits::propagate_on_container_move_assignment::value)
+	{
+		using std::swap;
+		swap(_alloc, other._alloc);
+	}
+
+	swap_slots(other);
+	return *this;
+}
+
+#pragma endregion
+
+#pragma region Iterator
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::iterator ArenaList<T, Alloc>::begin()
+{
+	return iterator(this, _head);
+}
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::iterator ArenaList<T, Alloc>::end()
+{
+	return iterator(this, npos);
+}
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::iterator::reference ArenaList<T, Alloc>::iterator::operator*() const
+{
+	return _list->_slots[_index]._val;
+}
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::iterator::pointer ArenaList<T, Alloc>::iterator::operator->() const
+{
+	return std::addressof(_list->_slots[_index]._val);
+}
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::iterator& ArenaList<T, Alloc>::iterator::operator++()
+{
+	_index = _list->_slots[_index]._next;
+	return *this;
+}
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::iterator ArenaList<T, Alloc>::iterator::operator++(int)
+{
+	iterator result(*this);
+	++(*this);
+	return result;
+}
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::iterator& ArenaList<T, Alloc>::iterator::operator--()
+{
+	_index = _index == npos ? _list->_tail : _list->_slots[_index]._prev;
+	return *this;
+}
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::iterator ArenaList<T, Alloc>::iterator::operator--(int)
+{
+	iterator result(*this);
+	--(*this);
+	return result;
+}
+
+template<typename T, typename Alloc>
+bool ArenaList<T, Alloc>::iterator::operator==(const iterator& other) const
+{
+	return _index == other._index;
+}
+
+template<typename T, typename Alloc>
+bool ArenaList<T, Alloc>::iterator::operator!=(const iterator& other) const
+{
+	return !(*this == other);
+}
+
+#pragma endregion
+
+#pragma region Const Iterator
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::const_iterator ArenaList<T, Alloc>::begin() const
+{
+	return const_iterator(this, _head);
+}
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::const_iterator ArenaList<T, Alloc>::end() const
+{
+	return const_iterator(this, npos);
+}
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::const_iterator ArenaList<T, Alloc>::cbegin() const
+{
+	return begin();
+}
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::const_iterator ArenaList<T, Alloc>::cend() const
+{
+	return end();
+}
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::const_iterator::reference ArenaList<T, Alloc>::const_iterator::operator*() const
+{
+	return _list->_slots[_index]._val;
+}
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::const_iterator::pointer ArenaList<T, Alloc>::const_iterator::operator->() const
+{
+	return std::addressof(_list->_slots[_index]._val);
+}
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::const_iterator& ArenaList<T, Alloc>::const_iterator::operator++()
+{
+	_index = _list->_slots[_index]._next;
+	return *this;
+}
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::const_iterator ArenaList<T, Alloc>::const_iterator::operator++(int)
+{
+	const_iterator result(*this);
+	++(*this);
+	return result;
+}
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::const_iterator& ArenaList<T, Alloc>::const_iterator::operator--()
+{
+	_index = _index == npos ? _list->_tail : _list->_slots[_index]._prev;
+	return *this;
+}
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::const_iterator ArenaList<T, Alloc>::const_iterator::operator--(int)
+{
+	const_iterator result(*this);
+	--(*this);
+	return result;
+}
+
+template<typename T, typename Alloc>
+bool ArenaList<T, Alloc>::const_iterator::operator==(const const_iterator& other) const
+{
+	return _index == other._index;
+}
+
+template<typename T, typename Alloc>
+bool ArenaList<T, Alloc>::const_iterator::operator!=(const const_iterator& other) const
+{
+	return !(*this == other);
+}
+
+#pragma endregion
+
+#pragma region Reverse Iterator
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::reverse_iterator ArenaList<T, Alloc>::rbegin()
+{
+	return reverse_iterator(end());
+}
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::reverse_iterator ArenaList<T, Alloc>::rend()
+{
+	return reverse_iterator(begin());
+}
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::const_reverse_iterator ArenaList<T, Alloc>::rbegin() const
+{
+	return const_reverse_iterator(end());
+}
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::const_reverse_iterator ArenaList<T, Alloc>::rend() const
+{
+	return const_reverse_iterator(begin());
+}
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::const_reverse_iterator ArenaList<T, Alloc>::crbegin() const
+{
+	return rbegin();
+}
+
+template<typename T, typename Alloc>
+ArenaList<T, Alloc>::const_reverse_iterator ArenaList<T, Alloc>::crend() const
+{
+	return rend();
+}
+
+#pragma endregion
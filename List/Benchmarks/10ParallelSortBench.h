@@ -0,0 +1,47 @@
+#pragma once
+#include "../List.h"
+#include "Fixtures/BenchHarness.h"
+#include <algorithm>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace bench
+{
+  struct ParallelSortBench
+  {
+    static void run()
+    {
+      constexpr std::size_t count = 4'000'000;
+      std::mt19937 rng(42);
+      std::vector<int> keys(count);
+      for(int& key : keys)
+        key = static_cast<int>(rng());
+
+      unsigned hardware = std::thread::hardware_concurrency();
+      std::cout << "hardware threads: " << hardware << "\n";
+
+      // Sorting scatters the nodes in memory. Before every run the nodes are put
+      // back in address order and refilled, so each run starts from the same layout.
+      List<int> lst(keys.begin(), keys.end());
+      auto reset = [&]{
+        lst.sort([](const int& lhs, const int& rhs){ return &lhs < &rhs; });
+        std::copy(keys.begin(), keys.end(), lst.begin());
+      };
+
+      reset();
+      report("sort()", measureMs([&]{ lst.sort(); }), count);
+
+      // The sweep goes past the hardware thread count so that numbers from
+      // different machines line up; beyond it, threads only add overhead.
+      for(std::size_t threads = 1; threads <= 64; threads *= 2)
+      {
+        reset();
+        double ms = measureMs([&]{ lst.parallel_sort(threads); });
+        report("parallel_sort(" + std::to_string(threads) + ")", ms, count);
+      }
+    }
+  };
+
+  static Register parallelSortBench("ParallelSort", &ParallelSortBench::run);
+}
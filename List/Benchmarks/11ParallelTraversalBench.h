@@ -0,0 +1,50 @@
+#pragma once
+#include "../List.h"
+#include "Fixtures/BenchHarness.h"
+#include <thread>
+
+namespace bench
+{
+  struct ParallelTraversalBench
+  {
+    static void run()
+    {
+      constexpr std::size_t count = 20'000'000;
+      List<int> lst;
+      for(std::size_t i = 0; i < count; ++i)
+        lst.push_back(static_cast<int>(i));
+
+      std::cout << "hardware threads: " << std::thread::hardware_concurrency() << "\n";
+
+      double serialMs = measureMs([&]{
+        long long sum = 0;
+        for(int val : lst)
+          sum += val;
+        doNotOptimize(sum);
+      });
+      report("serial sum", serialMs, count);
+
+      for(std::size_t threads = 1; threads <= 16; threads *= 2)
+      {
+        std::string suffix = "(" + std::to_string(threads) + ")";
+
+        double sumMs = measureMs([&]{
+          long long sum = lst.parallel_transform_reduce(0LL, std::plus<>(), [](int val){ return static_cast<long long>(val); }, threads);
+          doNotOptimize(sum);
+        });
+        report("parallel_transform_reduce" + suffix, sumMs, count);
+
+        double countMs = measureMs([&]{
+          std::size_t hits = lst.parallel_count_if([](int val){ return val % 3 == 0; }, threads);
+          doNotOptimize(hits);
+        });
+        report("parallel_count_if" + suffix, countMs, count);
+
+        double forEachMs = measureMs([&]{ lst.parallel_for_each([](int& val){ val += 1; }, threads); });
+        report("parallel_for_each" + suffix, forEachMs, count);
+      }
+    }
+  };
+
+  static Register parallelTraversalBench("ParallelTraversal", &ParallelTraversalBench::run);
+}
@@ -0,0 +1,201 @@
+#pragma once
+#include "../List.h"
+#include "Fixtures/BenchHarness.h"
+#include "Fixtures/BenchTypes.h"
+#include <algorithm>
+#include <deque>
+#include <iterator>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace bench
+{
+  template <typename T>
+  T makeValue(int key);
+
+  template <>
+  inline int makeValue<int>(int key)
+  {
+    return key;
+  }
+
+  // Long enough to defeat the small-string buffer, so every string owns heap memory.
+  template <>
+  inline std::string makeValue<std::string>(int key)
+  {
+    std::string digits = std::to_string(key);
+    return "value-" + std::string(24 - digits.size(), '0') + digits;
+  }
+
+  template <>
+  inline Record makeValue<Record>(int key)
+  {
+    return Record(key);
+  }
+
+  inline long long keyOf(int val) { return val; }
+  inline long long keyOf(const std::string& val) { return val.back(); }
+  inline long long keyOf(const Record& val) { return val.key; }
+
+  template <typename Container>
+  constexpr bool hasMemberSort = requires(Container& c) { c.sort(); };
+
+  template <typename Container>
+  void sortContainer(Container& c)
+  {
+    if constexpr (hasMemberSort<Container>)
+      c.sort();
+    else
+      std::stable_sort(c.begin(), c.end());
+  }
+
+  // Merges b into a; both are sorted. Lists relink, the others merge into place.
+  template <typename Container>
+  void mergeContainer(Container& a, Container& b)
+  {
+    if constexpr (hasMemberSort<Container>)
+      a.merge(b);
+    else
+    {
+      auto middle = static_cast<std::ptrdiff_t>(a.size());
+      a.insert(a.end(), std::make_move_iterator(b.begin()), std::make_move_iterator(b.end()));
+      b.clear();
+      std::inplace_merge(a.begin(), a.begin() + middle, a.end());
+    }
+  }
+
+  // Erases every other element, each container in its idiomatic way.
+  template <typename Container>
+  void eraseEveryOther(Container& c)
+  {
+    if constexpr (hasMemberSort<Container>)
+    {
+      auto it = c.begin();
+      while(it != c.end())
+      {
+        auto next = std::next(it);
+        c.erase(it);
+        it = next;
+        if(it != c.end())
+          ++it;
+      }
+    }
+    else
+    {
+      std::size_t index = 0;
+      c.erase(std::remove_if(c.begin(), c.end(), [&index](const auto&){ return index++ % 2 == 0; }), c.end());
+    }
+  }
+
+  template <typename Container>
+  void popFront(Container& c)
+  {
+    if constexpr (requires { c.pop_front(); })
+      c.pop_front();
+    else
+      c.erase(c.begin());
+  }
+
+  // Runs every operation on one container type with `count` elements.
+  template <typename Container, typename T>
+  void containerOps(const std::string& label, std::size_t count)
+  {
+    constexpr std::size_t middleInserts = 1'000;
+    constexpr std::size_t queueDepth = 1'000;
+
+    std::vector<int> keys(count);
+    std::mt19937 rng(7);
+    for(int& key : keys)
+      key = static_cast<int>(rng() % 1'000'000);
+
+    Container c;
+    report(label + " push_back", measureMs([&]{
+      for(int key : keys)
+        c.push_back(makeValue<T>(key));
+    }), count);
+
+    report(label + " iterate", measureMs([&]{
+      long long sum = 0;
+      for(const T& val : c)
+        sum += keyOf(val);
+      doNotOptimize(sum);
+    }), count);
+
+    {
+      Container copy;
+      report(label + " copy", measureMs([&]{ copy = c; }), count);
+      report(label + " clear", measureMs([&]{ copy.clear(); }), count);
+    }
+
+    {
+      Container queue;
+      for(std::size_t i = 0; i < queueDepth; ++i)
+        queue.push_back(makeValue<T>(static_cast<int>(i)));
+      report(label + " push_back+pop_front", measureMs([&]{
+        for(std::size_t i = 0; i < count; ++i)
+        {
+          queue.push_back(makeValue<T>(static_cast<int>(i)));
+          popFront(queue);
+        }
+      }), count);
+    }
+
+    {
+      Container copy(c);
+      auto pos = copy.begin();
+      std::advance(pos, copy.size() / 2);
+      std::ptrdiff_t offset = std::distance(copy.begin(), pos);
+      T val = makeValue<T>(42);
+      report(label + " insert at middle", measureMs([&]{
+        for(std::size_t i = 0; i < middleInserts; ++i)
+        {
+          if constexpr (hasMemberSort<Container>)
+            copy.insert(pos, val);
+          else
+            copy.insert(copy.begin() + offset, val);
+        }
+      }), middleInserts);
+    }
+
+    {
+      Container copy(c);
+      report(label + " erase every other", measureMs([&]{ eraseEveryOther(copy); }), count / 2);
+    }
+
+    {
+      Container copy(c);
+      report(label + " sort", measureMs([&]{ sortContainer(copy); }), count);
+    }
+
+    {
+      Container a(c.begin(), std::next(c.begin(), static_cast<std::ptrdiff_t>(count / 2)));
+      Container b(std::next(c.begin(), static_cast<std::ptrdiff_t>(count / 2)), c.end());
+      sortContainer(a);
+      sortContainer(b);
+      report(label + " merge", measureMs([&]{ mergeContainer(a, b); }), count);
+    }
+  }
+
+  template <typename T>
+  void compareContainers(const std::string& typeName, std::size_t count)
+  {
+    containerOps<List<T>, T>("List<" + typeName + ">", count);
+    containerOps<std::list<T>, T>("std::list<" + typeName + ">", count);
+    containerOps<std::deque<T>, T>("std::deque<" + typeName + ">", count);
+    containerOps<std::vector<T>, T>("std::vector<" + typeName + ">", count);
+  }
+
+  struct ContainerBench
+  {
+    static void run()
+    {
+      compareContainers<int>("int", 1'000'000);
+      compareContainers<std::string>("std::string", 250'000);
+      compareContainers<Record>("Record128", 250'000);
+    }
+  };
+
+  static Register containerBench("Containers", &ContainerBench::run);
+}
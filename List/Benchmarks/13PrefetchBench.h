@@ -0,0 +1,99 @@
+#pragma once
+#include "../List.h"
+#include "Fixtures/BenchHarness.h"
+#include "Fixtures/BenchTypes.h"
+#include <random>
+#include <string>
+
+namespace bench
+{
+  struct PrefetchBench
+  {
+    // Fills a list with random keys. Sorting relinks the nodes without moving them,
+    // so afterwards list order and address order are unrelated, as after long churn.
+    template <typename T>
+    static List<T> makeList(std::size_t count, bool fragmented)
+    {
+      std::mt19937 rng(11);
+      List<T> lst;
+      for(std::size_t i = 0; i < count; ++i)
+        lst.push_back(T(static_cast<int>(rng() % 1'000'000)));
+
+      if(fragmented)
+        lst.sort();
+      return lst;
+    }
+
+    static long long keyOf(int val) { return val; }
+    static long long keyOf(const Record& val) { return val.key; }
+
+    template <typename T>
+    static void traverse(const std::string& typeName, std::size_t count)
+    {
+      for(bool fragmented : {false, true})
+      {
+        List<T> lst = makeList<T>(count, fragmented);
+        std::string label = typeName + (fragmented ? " fragmented " : " in order ");
+        auto add = [](long long sum, const T& val){ return sum + keyOf(val); };
+
+        report(label + "range-for sum", measureMs([&]{
+          long long sum = 0;
+          for(const T& val : lst)
+            sum += keyOf(val);
+          doNotOptimize(sum);
+        }), count);
+
+        for(std::size_t distance : {0, 4, 8, 16, 32})
+        {
+          std::string suffix = "(" + std::to_string(distance) + ")";
+          report(label + "accumulate_prefetch" + suffix, measureMs([&]{
+            doNotOptimize(lst.accumulate_prefetch(0LL, add, distance));
+          }), count);
+        }
+
+        report(label + "count_if_prefetch(8)", measureMs([&]{
+          doNotOptimize(lst.count_if_prefetch([](const T& val){ return keyOf(val) % 3 == 0; }));
+        }), count);
+
+        report(label + "find_prefetch(8), absent", measureMs([&]{
+          doNotOptimize(lst.find_prefetch(T(-1)) == lst.end());
+        }), count);
+
+        // Prefetching overlaps the next miss with the work on the current element,
+        // so it pays off once that work is comparable to a memory access.
+        auto work = [](const T& val)
+        {
+          unsigned long long x = static_cast<unsigned long long>(keyOf(val)) | 1;
+          for(int round = 0; round < 48; ++round)
+          {
+            x ^= x << 13;
+            x ^= x >> 7;
+            x ^= x << 17;
+          }
+          return x;
+        };
+
+        report(label + "range-for heavy work", measureMs([&]{
+          unsigned long long acc = 0;
+          for(const T& val : lst)
+            acc += work(val);
+          doNotOptimize(acc);
+        }), count);
+
+        report(label + "for_each_prefetch(8) heavy work", measureMs([&]{
+          unsigned long long acc = 0;
+          lst.for_each_prefetch([&](const T& val){ acc += work(val); });
+          doNotOptimize(acc);
+        }), count);
+      }
+    }
+
+    static void run()
+    {
+      traverse<int>("List<int>", 4'000'000);
+      traverse<Record>("List<Record128>", 1'000'000);
+    }
+  };
+
+  static Register prefetchBench("Prefetch", &PrefetchBench::run);
+}
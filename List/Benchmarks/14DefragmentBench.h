@@ -0,0 +1,71 @@
+#pragma once
+#include "../List.h"
+#include "../PoolAllocator.h"
+#include "Fixtures/BenchHarness.h"
+#include "Fixtures/BenchTypes.h"
+#include <iostream>
+#include <random>
+#include <string>
+
+namespace bench
+{
+  struct DefragmentBench
+  {
+    static long long keyOf(int val) { return val; }
+    static long long keyOf(const Record& val) { return val.key; }
+
+    template <typename ListType>
+    static double scanMs(const ListType& lst)
+    {
+      return measureMs([&]{
+        long long sum = 0;
+        for(const auto& val : lst)
+          sum += keyOf(val);
+        doNotOptimize(sum);
+      });
+    }
+
+    // Scatters the nodes by sorting random keys, which relinks them without moving
+    // them; with `holes`, every other node is then freed, as cleanup passes do, so
+    // that the allocator has scattered free blocks to hand back first.
+    template <typename ListType>
+    static void scenario(const std::string& label, std::size_t count, bool holes)
+    {
+      using T = std::ranges::range_value_t<ListType>;
+
+      std::mt19937 rng(5);
+      ListType lst;
+      for(std::size_t i = 0; i < count; ++i)
+        lst.push_back(T(static_cast<int>(rng() % 1'000'000)));
+      report(label + " scan, built in order", scanMs(lst), lst.size());
+
+      lst.sort();
+      if(holes)
+      {
+        for(auto it = lst.begin(); it != lst.end();)
+        {
+          auto next = std::next(it);
+          lst.erase(it);
+          it = next == lst.end() ? next : std::next(next);
+        }
+      }
+
+      std::cout << label << " locality before: " << lst.locality() << "\n";
+      report(label + " scan, scattered", scanMs(lst), lst.size());
+      report(label + " defragment", measureMs([&]{ lst.defragment(); }), lst.size());
+      std::cout << label << " locality after: " << lst.locality() << "\n";
+      report(label + " scan, defragmented", scanMs(lst), lst.size());
+    }
+
+    static void run()
+    {
+      scenario<List<int>>("List<int>", 4'000'000, false);
+      scenario<List<int>>("List<int> with holes", 4'000'000, true);
+      scenario<List<int, PoolAllocator<int, 4096>>>("pool List<int> with holes", 4'000'000, true);
+      scenario<List<Record>>("List<Record128>", 1'000'000, false);
+      scenario<List<Record>>("List<Record128> with holes", 1'000'000, true);
+    }
+  };
+
+  static Register defragmentBench("Defragment", &DefragmentBench::run);
+}
@@ -0,0 +1,59 @@
+#pragma once
+#include "../List.h"
+#include "../PoolAllocator.h"
+#include "Fixtures/BenchHarness.h"
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace bench
+{
+  struct BulkRemoveBench
+  {
+    // An expiry pass: drops every entry whose key is below the cutoff.
+    template <typename ListType>
+    static void expire(const std::string& label, const std::vector<int>& keys)
+    {
+      auto expired = [](int key){ return key < 500'000; };
+
+      // Both lists are built before either is filtered, so neither is laid out
+      // in the holes the other one leaves behind.
+      ListType looped(keys.begin(), keys.end());
+      ListType filtered(keys.begin(), keys.end());
+
+      report(label + " erase loop", measureMs([&]{
+        for(auto it = looped.begin(); it != looped.end();)
+        {
+          if(expired(*it))
+            it = looped.erase(it);
+          else
+            ++it;
+        }
+      }), keys.size());
+
+      report(label + " remove_if", measureMs([&]{ doNotOptimize(filtered.remove_if(expired)); }), keys.size());
+    }
+
+    static void run()
+    {
+      constexpr std::size_t count = 4'000'000;
+      std::vector<int> keys(count);
+      std::mt19937 rng(9);
+      for(int& key : keys)
+        key = static_cast<int>(rng() % 1'000'000);
+
+      expire<List<int>>("List<int>", keys);
+      expire<List<int, PoolAllocator<int, 4096>>>("pool List<int>", keys);
+      expire<std::list<int>>("std::list<int>", keys);
+
+      // Runs of duplicates, as left by repeated appends of the same event.
+      std::vector<int> sorted(keys);
+      std::sort(sorted.begin(), sorted.end());
+      List<int> lst(sorted.begin(), sorted.end());
+      report("List<int> unique", measureMs([&]{ doNotOptimize(lst.unique()); }), count);
+    }
+  };
+
+  static Register bulkRemoveBench("BulkRemove", &BulkRemoveBench::run);
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include "../IndexedList.h"
+#include "../List.h"
+#include "Fixtures/BenchHarness.h"
+#include <random>
+#include <string>
+#include <vector>
+
+namespace bench
+{
+  struct IndexedBench
+  {
+    // Page seeks: jump to a random offset and read one page of elements from there.
+    static void run()
+    {
+      constexpr std::size_t pageSize = 50;
+
+      for(std::size_t count : {std::size_t(100'000), std::size_t(4'000'000)})
+      {
+        std::string suffix = " n=" + std::to_string(count);
+        const std::size_t seeks = count >= 1'000'000 ? 200 : 2'000;
+
+        std::mt19937 rng(13);
+        std::vector<std::size_t> offsets(seeks);
+        for(std::size_t& offset : offsets)
+          offset = rng() % (count - pageSize);
+
+        List<int> lst;
+        IndexedList<int> indexed;
+        report("List<int> push_back" + suffix, measureMs([&]{
+          for(std::size_t i = 0; i < count; ++i)
+            lst.push_back(static_cast<int>(i));
+        }), count);
+        report("IndexedList<int> push_back" + suffix, measureMs([&]{
+          for(std::size_t i = 0; i < count; ++i)
+            indexed.push_back(static_cast<int>(i));
+        }), count);
+
+        report("List<int> page seek" + suffix, measureMs([&]{
+          long long sum = 0;
+          for(std::size_t offset : offsets)
+          {
+            auto it = std::next(lst.begin(), offset);
+            for(std::size_t i = 0; i < pageSize; ++i, ++it)
+              sum += *it;
+          }
+          doNotOptimize(sum);
+        }), seeks);
+        report("IndexedList<int> page seek" + suffix, measureMs([&]{
+          long long sum = 0;
+          for(std::size_t offset : offsets)
+          {
+            auto it = indexed.iterator_at(offset);
+            for(std::size_t i = 0; i < pageSize; ++i, ++it)
+              sum += *it;
+          }
+          doNotOptimize(sum);
+        }), seeks);
+
+        report("IndexedList<int> index_of" + suffix, measureMs([&]{
+          std::size_t sum = 0;
+          for(std::size_t offset : offsets)
+            sum += indexed.index_of(indexed.iterator_at(offset));
+          doNotOptimize(sum);
+        }), seeks);
+        report("IndexedList<int> insert_at + erase_at" + suffix, measureMs([&]{
+          for(std::size_t offset : offsets)
+          {
+            indexed.insert_at(offset, -1);
+            indexed.erase_at(offset / 2);
+          }
+        }), seeks);
+      }
+    }
+  };
+
+  static Register indexedBench("Indexed", &IndexedBench::run);
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include "../List.h"
+#include "Fixtures/BenchHarness.h"
+
+namespace bench
+{
+  struct Payload64
+  {
+    long long values[8];
+
+    Payload64(long long seed = 0)
+    {
+      for(long long& v : values)
+        v = seed;
+    }
+  };
+
+  template <typename T>
+  void pushIterateClear(const char* label)
+  {
+    constexpr std::size_t count = 10'000'000;
+    List<T> lst;
+
+    double pushMs = measureMs([&]{
+      for(std::size_t i = 0; i < count; ++i)
+        lst.push_back(T(static_cast<int>(i)));
+    });
+    report(std::string(label) + " push_back", pushMs, count);
+
+    double iterateMs = measureMs([&]{
+      long long sum = 0;
+      for(const T& val : lst)
+        sum += reinterpret_cast<const char&>(val);
+      doNotOptimize(sum);
+    });
+    report(std::string(label) + " iterate", iterateMs, count);
+
+    double clearMs = measureMs([&]{ lst.clear(); });
+    report(std::string(label) + " clear", clearMs, count);
+  }
+
+  struct NodeLayoutBench
+  {
+    static void run()
+    {
+      pushIterateClear<int>("int");
+      pushIterateClear<Payload64>("Payload64");
+    }
+  };
+
+  static Register nodeLayoutBench("NodeLayout", &NodeLayoutBench::run);
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include "../List.h"
+#include "../PoolAllocator.h"
+#include "Fixtures/AllocationCounter.h"
+#include "Fixtures/BenchHarness.h"
+
+namespace bench
+{
+  template <typename ListType>
+  void queueChurn(const char* label)
+  {
+    constexpr std::size_t depth = 1'000;
+    constexpr std::size_t rounds = 10'000'000;
+    ListType lst;
+    for(std::size_t i = 0; i < depth; ++i)
+      lst.push_back(static_cast<int>(i));
+
+    std::size_t allocationsBefore = allocationCount();
+    double ms = measureMs([&]{
+      for(std::size_t i = 0; i < rounds; ++i)
+      {
+        lst.push_back(static_cast<int>(i));
+        lst.pop_front();
+      }
+    });
+    std::size_t allocations = allocationCount() - allocationsBefore;
+
+    report(std::string(label) + " push_back+pop_front", ms, rounds);
+    std::cout << label << " heap allocations: " << allocations << "\n";
+  }
+
+  struct ChurnBench
+  {
+    static void run()
+    {
+      queueChurn<List<int>>("List<int>");
+      queueChurn<List<int, PoolAllocator<int>>>("List<int, PoolAllocator<int>>");
+    }
+  };
+
+  static Register churnBench("Churn", &ChurnBench::run);
+}
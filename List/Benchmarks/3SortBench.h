@@ -0,0 +1,56 @@
+#pragma once
+#include "../List.h"
+#include "Fixtures/BenchHarness.h"
+#include "Fixtures/BenchTypes.h"
+#include <algorithm>
+#include <list>
+#include <random>
+#include <vector>
+
+namespace bench
+{
+  inline std::vector<int> sortInput(const char* shape, std::size_t count)
+  {
+    std::vector<int> keys(count);
+    std::mt19937 rng(42);
+    for(std::size_t i = 0; i < count; ++i)
+      keys[i] = static_cast<int>(rng());
+
+    if(std::string(shape) == "sorted")
+      std::sort(keys.begin(), keys.end());
+    else if(std::string(shape) == "reversed")
+      std::sort(keys.rbegin(), keys.rend());
+    else if(std::string(shape) == "duplicates")
+      for(int& key : keys)
+        key &= 15;
+
+    return keys;
+  }
+
+  template <typename T>
+  void compareSort(const char* label, const char* shape, std::size_t count)
+  {
+    std::vector<int> keys = sortInput(shape, count);
+
+    List<T> lst(keys.begin(), keys.end());
+    std::list<T> stdLst(keys.begin(), keys.end());
+
+    report(std::string(label) + " " + shape + " List::sort", measureMs([&]{ lst.sort(); }), count);
+    report(std::string(label) + " " + shape + " std::list::sort", measureMs([&]{ stdLst.sort(); }), count);
+  }
+
+  struct SortBench
+  {
+    static void run()
+    {
+      constexpr std::size_t count = 1'000'000;
+      for(const char* shape : {"random", "sorted", "reversed", "duplicates"})
+      {
+        compareSort<int>("int", shape, count);
+        compareSort<Record>("Record128", shape, count);
+      }
+    }
+  };
+
+  static Register sortBench("Sort", &SortBench::run);
+}
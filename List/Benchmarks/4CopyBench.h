@@ -0,0 +1,46 @@
+#pragma once
+#include "../List.h"
+#include "../PoolAllocator.h"
+#include "Fixtures/AllocationCounter.h"
+#include "Fixtures/BenchHarness.h"
+
+namespace bench
+{
+  template <typename ListType>
+  void copyAllocations(const char* label, std::size_t count)
+  {
+    ListType source;
+    for(std::size_t i = 0; i < count; ++i)
+      source.push_back(static_cast<int>(i));
+
+    ListType snapshot(source);
+    source.front() = -1;
+
+    std::size_t allocationsBefore = allocationCount();
+    double assignMs = measureMs([&]{ snapshot = source; });
+    std::size_t assignAllocations = allocationCount() - allocationsBefore;
+
+    allocationsBefore = allocationCount();
+    double constructMs = 0;
+    {
+      constructMs = measureMs([&]{ ListType copy(source); doNotOptimize(copy.size()); });
+    }
+    std::size_t constructAllocations = allocationCount() - allocationsBefore;
+
+    report(std::string(label) + " same-size copy assignment", assignMs, count);
+    std::cout << label << " same-size copy assignment heap allocations: " << assignAllocations << "\n";
+    report(std::string(label) + " copy construction (incl. destruction)", constructMs, count);
+    std::cout << label << " copy construction heap allocations: " << constructAllocations << "\n";
+  }
+
+  struct CopyBench
+  {
+    static void run()
+    {
+      copyAllocations<List<int>>("List<int>", 1'000'000);
+      copyAllocations<List<int, PoolAllocator<int>>>("List<int, PoolAllocator<int>>", 1'000'000);
+    }
+  };
+
+  static Register copyBench("Copy", &CopyBench::run);
+}
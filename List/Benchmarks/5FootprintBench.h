@@ -0,0 +1,42 @@
+#pragma once
+#include "../List.h"
+#include "Fixtures/AllocationCounter.h"
+#include "Fixtures/BenchHarness.h"
+#include <memory>
+
+namespace bench
+{
+  void listFootprint(const char* label, std::size_t elementsPerList)
+  {
+    constexpr std::size_t count = 10'000'000;
+
+    std::size_t allocationsBefore = allocationCount();
+    std::size_t bytesBefore = allocatedBytes();
+    std::unique_ptr<List<int>[]> lists;
+    double ms = measureMs([&]{
+      lists.reset(new List<int>[count]);
+      for(std::size_t i = 0; i < count; ++i)
+        for(std::size_t j = 0; j < elementsPerList; ++j)
+          lists[i].push_back(static_cast<int>(j));
+    });
+    std::size_t allocations = allocationCount() - allocationsBefore;
+    std::size_t bytes = allocatedBytes() - bytesBefore;
+
+    report(std::string(label) + " construct", ms, count);
+    std::cout << label << " heap allocations per list: " << static_cast<double>(allocations - 1) / count << "\n";
+    std::cout << label << " bytes per list (object + heap): " << static_cast<double>(bytes) / count << "\n";
+    report(std::string(label) + " destroy", measureMs([&]{ lists.reset(); }), count);
+  }
+
+  struct FootprintBench
+  {
+    static void run()
+    {
+      std::cout << "sizeof(List<int>): " << sizeof(List<int>) << "\n";
+      listFootprint("10M empty List<int>", 0);
+      listFootprint("10M one-element List<int>", 1);
+    }
+  };
+
+  static Register footprintBench("Footprint", &FootprintBench::run);
+}
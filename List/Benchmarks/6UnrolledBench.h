@@ -0,0 +1,72 @@
+#pragma once
+#include "../List.h"
+#include "../UnrolledList.h"
+#include "Fixtures/BenchHarness.h"
+#include <list>
+
+namespace bench
+{
+  // push_back n elements, scan them once, then insert 1000 elements one after
+  // another at the middle of the container.
+  template <typename ListType>
+  void scanPushInsert(const char* label, std::size_t count)
+  {
+    constexpr std::size_t inserts = 1'000;
+    std::string name = std::string(label) + " n=" + std::to_string(count);
+    ListType lst;
+
+    double pushMs = measureMs([&]{
+      for(std::size_t i = 0; i < count; ++i)
+        lst.push_back(static_cast<int>(i));
+    });
+    report(name + " push_back", pushMs, count);
+
+    double scanMs = measureMs([&]{
+      long long sum = 0;
+      for(int val : lst)
+        sum += val;
+      doNotOptimize(sum);
+    });
+    report(name + " scan", scanMs, count);
+
+    auto middle = lst.begin();
+    for(std::size_t i = 0; i < count / 2; ++i)
+      ++middle;
+
+    double insertMs = measureMs([&]{
+      auto pos = middle;
+      for(std::size_t i = 0; i < inserts; ++i)
+        pos = lst.insert(pos, static_cast<int>(i));
+      doNotOptimize(*pos);
+    });
+    report(name + " mid insert", insertMs, inserts);
+  }
+
+  // List::insert(pos, val) returns void; this adapter hands back the new
+  // element so the same loop drives every container.
+  struct ListAdapter : List<int>
+  {
+    iterator insert(const iterator& pos, int val)
+    {
+      return emplace(pos, val);
+    }
+  };
+
+  struct UnrolledBench
+  {
+    static void run()
+    {
+      // 100M ints need roughly 3.2GB as one-element nodes; drop the last size on
+      // machines with less memory.
+      for(std::size_t count : {std::size_t(1'000), std::size_t(100'000), std::size_t(10'000'000), std::size_t(100'000'000)})
+      {
+        scanPushInsert<std::list<int>>("std::list<int>", count);
+        scanPushInsert<ListAdapter>("List<int>", count);
+        scanPushInsert<UnrolledList<int, 16>>("UnrolledList<int, 16>", count);
+        scanPushInsert<UnrolledList<int, 64>>("UnrolledList<int, 64>", count);
+      }
+    }
+  };
+
+  static Register unrolledBench("Unrolled", &UnrolledBench::run);
+}
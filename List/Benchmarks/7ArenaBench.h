@@ -0,0 +1,75 @@
+#pragma once
+#include "../ArenaList.h"
+#include "../List.h"
+#include "Fixtures/AllocationCounter.h"
+#include "Fixtures/BenchHarness.h"
+#include <vector>
+
+namespace bench
+{
+  template <typename ListType, bool Reserve = false>
+  void perElementCost(const char* label)
+  {
+    constexpr std::size_t count = 10'000'000;
+
+    std::size_t allocationsBefore = allocationCount();
+    std::size_t bytesBefore = allocatedBytes();
+    ListType lst;
+    double pushMs = measureMs([&]{
+      if constexpr (Reserve)
+        lst.reserve(count);
+      for(std::size_t i = 0; i < count; ++i)
+        lst.push_back(static_cast<int>(i));
+    });
+    std::size_t allocations = allocationCount() - allocationsBefore;
+    std::size_t bytes = allocatedBytes() - bytesBefore;
+
+    report(std::string(label) + " push_back", pushMs, count);
+    std::cout << label << " heap allocations: " << allocations << "\n";
+    // Requested bytes: without reserve this includes every array ArenaList grew
+    // through, and each List node additionally pays a malloc header.
+    std::cout << label << " bytes allocated per element: " << static_cast<double>(bytes) / count << "\n";
+
+    double scanMs = measureMs([&]{
+      long long sum = 0;
+      for(int val : lst)
+        sum += val;
+      doNotOptimize(sum);
+    });
+    report(std::string(label) + " scan", scanMs, count);
+  }
+
+  struct ArenaBench
+  {
+    static void run()
+    {
+      perElementCost<List<int>>("List<int>");
+      perElementCost<ArenaList<int>>("ArenaList<int>");
+      perElementCost<ArenaList<int>, true>("ArenaList<int> reserved");
+
+      // Erase every other element through stored handles, then refill the freed slots.
+      constexpr std::size_t count = 1'000'000;
+      ArenaList<int> lst;
+      std::vector<ArenaList<int>::handle> handles;
+      handles.reserve(count);
+      for(std::size_t i = 0; i < count; ++i)
+        handles.push_back(lst.emplace_back(static_cast<int>(i)));
+
+      double eraseMs = measureMs([&]{
+        for(std::size_t i = 0; i < count; i += 2)
+          lst.erase(handles[i]);
+      });
+      report("ArenaList<int> erase by handle", eraseMs, count / 2);
+
+      std::size_t capacity = lst.capacity();
+      double refillMs = measureMs([&]{
+        for(std::size_t i = 0; i < count; i += 2)
+          lst.push_back(static_cast<int>(i));
+      });
+      report("ArenaList<int> refill freed slots", refillMs, count / 2);
+      std::cout << "ArenaList<int> capacity grew: " << (lst.capacity() != capacity ? "yes" : "no") << "\n";
+    }
+  };
+
+  static Register arenaBench("Arena", &ArenaBench::run);
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include "../ForwardList.h"
+#include "../List.h"
+#include "Fixtures/AllocationCounter.h"
+#include "Fixtures/BenchHarness.h"
+
+namespace bench
+{
+  // Fills a queue to the given depth, then runs push_back + pop_front rounds.
+  template <typename QueueType>
+  void queueWorkload(const char* label)
+  {
+    constexpr std::size_t depth = 1'000'000;
+    constexpr std::size_t rounds = 10'000'000;
+
+    std::size_t bytesBefore = allocatedBytes();
+    QueueType queue;
+    double fillMs = measureMs([&]{
+      for(std::size_t i = 0; i < depth; ++i)
+        queue.push_back(static_cast<int>(i));
+    });
+    std::size_t bytes = allocatedBytes() - bytesBefore;
+
+    report(std::string(label) + " fill", fillMs, depth);
+    std::cout << label << " bytes allocated per element: " << static_cast<double>(bytes) / depth << "\n";
+
+    double churnMs = measureMs([&]{
+      for(std::size_t i = 0; i < rounds; ++i)
+      {
+        queue.push_back(static_cast<int>(i));
+        queue.pop_front();
+      }
+    });
+    report(std::string(label) + " push_back+pop_front", churnMs, rounds);
+
+    double drainMs = measureMs([&]{
+      long long sum = 0;
+      while(!queue.empty())
+      {
+        sum += queue.front();
+        queue.pop_front();
+      }
+      doNotOptimize(sum);
+    });
+    report(std::string(label) + " drain", drainMs, depth);
+  }
+
+  struct QueueBench
+  {
+    static void run()
+    {
+      queueWorkload<List<int>>("List<int>");
+      queueWorkload<ForwardList<int>>("ForwardList<int>");
+    }
+  };
+
+  static Register queueBench("Queue", &QueueBench::run);
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include "../List.h"
+#include "../SmallList.h"
+#include "Fixtures/AllocationCounter.h"
+#include "Fixtures/BenchHarness.h"
+
+namespace bench
+{
+  // Builds, sums and destroys many short-lived lists of a few elements each.
+  template <typename ListType>
+  void shortLivedLists(const char* label, std::size_t elementsPerList)
+  {
+    constexpr std::size_t lists = 2'000'000;
+
+    std::size_t allocationsBefore = allocationCount();
+    double ms = measureMs([&]{
+      long long sum = 0;
+      for(std::size_t i = 0; i < lists; ++i)
+      {
+        ListType lst;
+        for(std::size_t j = 0; j < elementsPerList; ++j)
+          lst.push_back(static_cast<int>(i + j));
+        for(int val : lst)
+          sum += val;
+      }
+      doNotOptimize(sum);
+    });
+    std::size_t allocations = allocationCount() - allocationsBefore;
+
+    std::string name = std::string(label) + " x" + std::to_string(elementsPerList);
+    report(name + " build+scan+destroy", ms, lists);
+    std::cout << name << " heap allocations per list: " << static_cast<double>(allocations) / lists << "\n";
+  }
+
+  struct SmallListBench
+  {
+    static void run()
+    {
+      for(std::size_t elements : {std::size_t(4), std::size_t(8), std::size_t(16)})
+      {
+        shortLivedLists<List<int>>("List<int>", elements);
+        shortLivedLists<SmallList<int, 8>>("SmallList<int, 8>", elements);
+      }
+    }
+  };
+
+  static Register smallListBench("SmallList", &SmallListBench::run);
+}
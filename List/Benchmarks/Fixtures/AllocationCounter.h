@@ -0,0 +1,23 @@
+#pragma once
+
+#include "../../Tests/Fixtures/AllocationCounter.h"
+
+#include <cstddef>
+
+// The benchmarks count heap use through the allocation functions replaced by the
+// test fixture, so both executables share one set of atomic counters; the
+// parallel benchmarks allocate from worker pool threads. Include from exactly one
+// translation unit.
+namespace bench
+{
+  inline std::size_t allocationCount()
+  {
+    return test::allocationCounter;
+  }
+
+  // Bytes requested from the heap so far (never decremented).
+  inline std::size_t allocatedBytes()
+  {
+    return test::allocatedBytesCounter;
+  }
+}
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace bench
+{
+
+struct Case
+{
+  const char* name;
+  void (*run)();
+};
+
+inline std::vector<Case>& registry()
+{
+  static std::vector<Case> cases;
+  return cases;
+}
+
+// Benchmarks register themselves the same way tests run themselves: through a
+// static object whose constructor is executed before main().
+struct Register
+{
+  Register(const char* name, void (*run)())
+  {
+    registry().push_back({name, run});
+  }
+};
+
+template <typename Func>
+double measureMs(Func&& func)
+{
+  auto start = std::chrono::steady_clock::now();
+  std::forward<Func>(func)();
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+struct Result
+{
+  std::string benchmark;
+  std::string name;
+  double ms;
+  std::size_t n;
+};
+
+inline std::vector<Result>& results()
+{
+  static std::vector<Result> recorded;
+  return recorded;
+}
+
+inline std::string& currentCase()
+{
+  static std::string name;
+  return name;
+}
+
+inline void report(const std::string& name, double ms, std::size_t n)
+{
+  std::cout << name << ": " << ms << " ms (" << (ms * 1e6 / (n ? n : 1)) << " ns/op)\n";
+  results().push_back({currentCase(), name, ms, n});
+}
+
+inline std::string jsonEscape(const std::string& text)
+{
+  std::string escaped;
+  for(char c : text)
+  {
+    if(c == '"' || c == '\\')
+      escaped += '\\';
+    escaped += c;
+  }
+  return escaped;
+}
+
+// One object per report() call, so runs can be diffed release over release.
+inline void writeJson(const char* path)
+{
+  std::ofstream out(path);
+  out << "{\n  \"results\": [";
+  for(std::size_t i = 0; i < results().size(); ++i)
+  {
+    const Result& r = results()[i];
+    out << (i ? "," : "") << "\n    {\"benchmark\": \"" << jsonEscape(r.benchmark)
+        << "\", \"name\": \"" << jsonEscape(r.name)
+        << "\", \"ms\": " << r.ms
+        << ", \"n\": " << r.n
+        << ", \"ns_per_op\": " << (r.ms * 1e6 / (r.n ? r.n : 1)) << "}";
+  }
+  out << "\n  ]\n}\n";
+}
+
+// Keeps the optimizer from discarding a computed value.
+template <typename T>
+void doNotOptimize(const T& value)
+{
+#if defined(_MSC_VER)
+  static const volatile void* sink;
+  sink = &value;
+#else
+  asm volatile("" : : "r,m"(value) : "memory");
+#endif
+}
+
+// Usage: bench [filter] [--json=path]. The filter runs only the benchmarks whose
+// name contains it; --json also writes every reported measurement to path.
+inline int runAll(int argc, char** argv)
+{
+  const char* filter = nullptr;
+  const char* jsonPath = nullptr;
+  for(int i = 1; i < argc; ++i)
+  {
+    if(std::strncmp(argv[i], "--json=", 7) == 0)
+      jsonPath = argv[i] + 7;
+    else
+      filter = argv[i];
+  }
+
+  for(const Case& c : registry())
+  {
+    if(filter && !std::strstr(c.name, filter))
+      continue;
+
+    std::cout << "== " << c.name << " ==\n";
+    currentCase() = c.name;
+    c.run();
+  }
+
+  if(jsonPath)
+    writeJson(jsonPath);
+  return 0;
+}
+
+}// namespace bench
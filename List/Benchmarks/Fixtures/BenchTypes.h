@@ -0,0 +1,18 @@
+#pragma once
+
+namespace bench
+{
+  // A 128-byte plain record: a sort key followed by payload that is copied along.
+  struct Record
+  {
+    int key;
+    char payload[124];
+
+    Record(int key = 0) : key(key), payload{} { }
+
+    bool operator<(const Record& other) const { return key < other.key; }
+    bool operator==(const Record& other) const { return key == other.key; }
+  };
+
+  static_assert(sizeof(Record) == 128);
+}
@@ -0,0 +1,25 @@
+// Benchmarks are a separate executable from the test runner in main.cpp: the
+// list_bench CMake target, built as Release by default. Run it as
+// list_bench [filter] [--json=path].
+
+#include "1NodeLayoutBench.h"
+#include "2ChurnBench.h"
+#include "3SortBench.h"
+#include "4CopyBench.h"
+#include "5FootprintBench.h"
+#include "6UnrolledBench.h"
+#include "7ArenaBench.h"
+#include "8QueueBench.h"
+#include "9SmallListBench.h"
+#include "10ParallelSortBench.h"
+#include "11ParallelTraversalBench.h"
+#include "12ContainerBench.h"
+#include "13PrefetchBench.h"
+#include "14DefragmentBench.h"
+#include "15BulkRemoveBench.h"
+#include "16IndexedBench.h"
+
+int main(int argc, char** argv)
+{
+  return bench::runAll(argc, argv);
+}
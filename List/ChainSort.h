@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+
+// Merge sort over null-terminated chains of nodes linked through _next, shared
+// by List and ForwardList. Only _next is relinked; each list restores its own
+// back links, sentinel or tail afterwards. less(lhs, rhs) compares the values
+// of two nodes.
+namespace detail
+{
+	// Merges two sorted chains; on ties the node from `first` wins.
+	template <typename Node, typename Less>
+	Node* merge_chains(Node* first, Node* second, Less& less)
+	{
+		Node head;
+		Node* last = &head;
+
+		while (first != nullptr && second != nullptr)
+		{
+			if (less(second, first))
+			{
+				last->_next = second;
+				second = second->_next;
+			}
+			else
+			{
+				last->_next = first;
+				first = first->_next;
+			}
+
+			last = last->_next;
+		}
+
+		last->_next = first != nullptr ? first : second;
+		return head._next;
+	}
+
+	// Bottom-up merge sort: stable, O(n log n), returns the new head. bins[i] holds
+	// a sorted run of 2^i nodes, earlier runs in higher bins, so merging older runs
+	// first keeps the sort stable.
+	template <typename Node, typename Less>
+	Node* sort_chain(Node* first, Less& less)
+	{
+		Node* bins[64] = {};
+		Node* rest = first;
+
+		while (rest != nullptr)
+		{
+			Node* run = rest;
+			rest = rest->_next;
+			run->_next = nullptr;
+
+			size_t i = 0;
+			for (; bins[i] != nullptr; ++i)
+			{
+				run = merge_chains(bins[i], run, less);
+				bins[i] = nullptr;
+			}
+
+			bins[i] = run;
+		}
+
+		Node* sorted = nullptr;
+		for (Node* bin : bins)
+		{
+			if (bin != nullptr)
+				sorted = sorted ? merge_chains(bin, sorted, less) : bin;
+		}
+
+		return sorted;
+	}
+}
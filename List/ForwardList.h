@@ -0,0 +1,865 @@
+#pragma once
+
+#include "ChainSort.h"
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+// Singly linked list for queue-like use: one link per node, the value stored
+// inline after it, and a tail pointer so that push_back is O(1) alongside
+// push_front and pop_front. Positions are expressed "after" an iterator, as in
+// std::forward_list; before_begin() designates the position before the first node.
+template <typename T, typename Alloc = std::allocator<T>>
+class ForwardList
+{
+
+public:
+
+	using allocator_type = Alloc;
+
+private:
+
+#pragma region Node
+
+	struct NodeBase
+	{
+		NodeBase* _next;
+
+		NodeBase(NodeBase* next = nullptr);
+	};
+
+	struct Node : NodeBase
+	{
+		union
+		{
+			T _val;
+		};
+
+		Node(NodeBase* next = nullptr);
+		~Node();
+	};
+
+	using AllocTraits = std::allocator_traits<Alloc>;
+	using NodeAlloc = typename AllocTraits::template rebind_alloc<Node>;
+	using NodeTraits = std::allocator_traits<NodeAlloc>;
+
+	static T& value(NodeBase* node);
+	static const T& value(const NodeBase* node);
+
+	template <typename... Args>
+	Node* create_node(NodeBase* next, Args&&... args);
+	void destroy_node(NodeBase* node);
+	void swap_nodes(ForwardList& other) noexcept;
+	bool shares_nodes(const ForwardList& other) const;
+	void move_nodes(NodeBase* pos, ForwardList& other, NodeBase* before, NodeBase* last);
+
+
+	// _head is the before-begin node; _tail is the last node, or &_head when empty.
+	// The chain is null-terminated, so end() is a null iterator.
+	[[no_unique_address]] NodeAlloc _alloc;
+	NodeBase _head;
+	NodeBase* _tail;
+	size_t _size;
+
+#pragma endregion
+
+public:
+
+#pragma region Iterator
+
+	class iterator
+	{
+	public:
+		using value_type = T;
+		using difference_type = std::ptrdiff_t;
+		using pointer = T*;
+		using reference = T&;
+		using iterator_category = std::forward_iterator_tag;
+
+	private:
+		NodeBase* _node;
+
+	public:
+		iterator(NodeBase* node = nullptr);
+
+		reference operator*() const;
+		pointer operator->() const;
+		iterator& operator++();
+		iterator operator++(int);
+		bool operator==(const iterator& other) const;
+		bool operator!=(const iterator& other) const;
+
+		friend class const_iterator;
+		friend class ForwardList;
+	};
+
+	static_assert(std::forward_iterator<iterator>);
+
+#pragma endregion
+
+#pragma region Const Iterator
+
+	class const_iterator
+	{
+	public:
+		using value_type = T;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const T*;
+		using reference = const T&;
+		using iterator_category = std::forward_iterator_tag;
+
+	private:
+		const NodeBase* _node;
+
+	public:
+		const_iterator(const NodeBase* node = nullptr);
+		const_iterator(const iterator& iter);
+
+		reference operator*() const;
+		pointer operator->() const;
+		const_iterator& operator++();
+		const_iterator operator++(int);
+		bool operator==(const const_iterator& other) const;
+		bool operator!=(const const_iterator& other) const;
+
+		friend class ForwardList;
+	};
+
+	static_assert(std::forward_iterator<const_iterator>);
+
+#pragma endregion
+
+	ForwardList() noexcept(noexcept(Alloc()));
+	explicit ForwardList(const Alloc& alloc) noexcept;
+	ForwardList(std::initializer_list<T> initList, const Alloc& alloc = Alloc());
+	template <std::input_iterator iter>
+	ForwardList(iter begin, iter end, const Alloc& alloc = Alloc());
+	ForwardList(const ForwardList& other);
+	ForwardList(ForwardList&& other) noexcept;
+	~ForwardList();
+
+	allocator_type get_allocator() const;
+
+	bool empty() const noexcept;
+	size_t size() const noexcept;
+	T& front();
+	const T& front() const;
+	T& back();
+	const T& back() const;
+	void clear();
+
+	void push_front(const T& val);
+	void push_front(T&& val);
+	void push_back(const T& val);
+	void push_back(T&& val);
+	template <typename... Args>
+	T& emplace_front(Args&&... args);
+	template <typename... Args>
+	T& emplace_back(Args&&... args);
+	void pop_front();
+	template <typename... Args>
+	iterator emplace_after(const const_iterator& pos, Args&&... args);
+	iterator insert_after(const const_iterator& pos, const T& val);
+	iterator insert_after(const const_iterator& pos, T&& val);
+	iterator erase_after(const const_iterator& pos);
+	iterator erase_after(const const_iterator& first, const const_iterator& last);
+	void splice_after(const const_iterator& pos, ForwardList& other);
+	void splice_after(const const_iterator& pos, ForwardList&& other);
+	void splice_after(const const_iterator& pos, ForwardList& other, const const_iterator& before);
+	void splice_after(const const_iterator& pos, ForwardList&& other, const const_iterator& before);
+	void sort();
+	template <typename Compare>
+	void sort(Compare comp);
+	void swap(ForwardList& other);
+
+	iterator before_begin();
+	const_iterator before_begin() const;
+	const_iterator cbefore_begin() const;
+	iterator begin();
+	iterator end();
+	const_iterator begin() const;
+	const_iterator end() const;
+	const_iterator cbegin() const;
+	const_iterator cend() const;
+
+	ForwardList& operator=(const ForwardList& other);
+	ForwardList& operator=(ForwardList&& other) noexcept(AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value);
+
+	template <typename U, typename A>
+	friend bool operator==(const ForwardList<U, A>& lhs, const ForwardList<U, A>& rhs);
+
+};
+
+#pragma region CtorsAndDestructors
+
+template<typename T, typename Alloc>
+ForwardList<T, Alloc>::ForwardList() noexcept(noexcept(Alloc())) : ForwardList(Alloc()) { }
+
+template<typename T, typename Alloc>
+ForwardList<T, Alloc>::ForwardList(const Alloc& alloc) noexcept : _alloc(alloc), _head(nullptr), _tail(&_head), _size(0) { }
+
+template<typename T, typename Alloc>
+ForwardList<T, Alloc>::ForwardList(std::initializer_list<T> initList, const Alloc& alloc)
+	: ForwardList(initList.begin(), initList.end(), alloc) { }
+
+template<typename T, typename Alloc>
+template<std::input_iterator iter>
+ForwardList<T, Alloc>::ForwardList(iter begin, iter end, const Alloc& alloc) : ForwardList(alloc)
+{
+	for (auto it = begin; it != end; ++it)
+		emplace_back(*it);
+}
+
+template<typename T, typename Alloc>
+ForwardList<T, Alloc>::ForwardList(const ForwardList& other)
+	: ForwardList(other.begin(), other.end(), AllocTraits::select_on_container_copy_construction(other.get_allocator())) { }
+
+template<typename T, typename Alloc>
+ForwardList<T, Alloc>::ForwardList(ForwardList&& other) noexcept : ForwardList(other.get_allocator())
+{
+	swap_nodes(other);
+}
+
+template<typename T, typename Alloc>
+ForwardList<T, Alloc>::~ForwardList()
+{
+	clear();
+}
+
+template<typename T, typename Alloc>
+ForwardList<T, Alloc>::allocator_type ForwardList<T, Alloc>::get_allocator() const
+{
+	return allocator_type(_alloc);
+}
+
+template<typename T, typename Alloc>
+ForwardList<T, Alloc>::NodeBase::NodeBase(NodeBase* next) : _next(next) { }
+
+template<typename T, typename Alloc>
+ForwardList<T, Alloc>::Node::Node(NodeBase* next) : NodeBase(next) { }
+
+template<typename T, typename Alloc>
+ForwardList<T, Alloc>::Node::~Node() { }
+
+template<typename T, typename Alloc>
+ForwardList<T, Alloc>::iterator::iterator(NodeBase* node) : _node(node) { }
+
+template<typename T, typename Alloc>
+ForwardList<T, Alloc>::const_iterator::const_iterator(const NodeBase* node) : _node(node) { }
+
+template<typename T, typename Alloc>
+ForwardList<T, Alloc>::const_iterator::const_iterator(const iterator& iter) : _node(iter._node) { }
+
+#pragma endregion
+
+#pragma region Node
+
+template<typename T, typename Alloc>
+T& ForwardList<T, Alloc>::value(NodeBase* node)
+{
+	return static_cast<Node*>(node)->_val;
+}
+
+template<typename T, typename Alloc>
+const T& ForwardList<T, Alloc>::value(const NodeBase* node)
+{
+	return static_cast<const Node*>(node)->_val;
+}
+
+template<typename T, typename Alloc>
+template<typename... Args>
+ForwardList<T, Alloc>::Node* ForwardList<T, Alloc>::create_node(NodeBase* next, Args&&... args)
+{
+	Node* node = NodeTraits::allocate(_alloc, 1);
+	::new (static_cast<void*>(node)) Node(next);
+
+	try
+	{
+		NodeTraits::construct(_alloc, std::addressof(node->_val), std::forward<Args>(args)...);
+	}
+	catch (...)
+	{
+		node->~Node();
+		NodeTraits::deallocate(_alloc, node, 1);
+		throw;
+	}
+
+	return node;
+}
+
+template<typename T, typename Alloc>
+void ForwardList<T, Alloc>::destroy_node(NodeBase* node)
+{
+	Node* p = static_cast<Node*>(node);
+	NodeTraits::destroy(_alloc, std::addressof(p->_val));
+	p->~Node();
+	NodeTraits::deallocate(_alloc, p, 1);
+}
+
+// Only the tail can point into the list object itself, so it is the one link
+// re-aimed after the exchange.
+template<typename T, typename Alloc>
+void ForwardList<T, Alloc>::swap_nodes(ForwardList& other) noexcept
+{
+	std::swap(_head._next, other._head._next);
+	std::swap(_tail, other._tail);
+	std::swap(_size, other._size);
+
+	for (ForwardList* lst : { this, &other })
+	{
+		if (lst->_size == 0)
+			lst->_tail = &lst->_head;
+	}
+}
+
+// Whether nodes allocated by other's allocator can be freed through this one.
+template<typename T, typename Alloc>
+bool ForwardList<T, Alloc>::shares_nodes(const ForwardList& other) const
+{
+	return AllocTraits::is_always_equal::value || _alloc == other._alloc;
+}
+
+// Moves the values of other's nodes in the open range (before, last) into new
+// nodes after pos, then erases them from other. If a move constructor throws,
+// both lists keep their nodes.
+template<typename T, typename Alloc>
+void ForwardList<T, Alloc>::move_nodes(NodeBase* pos, ForwardList& other, NodeBase* before, NodeBase* last)
+{
+	if (before->_next == last)
+		return;
+
+	NodeBase chain;
+	NodeBase* chainTail = &chain;
+	size_t count = 0;
+	try
+	{
+		for (NodeBase* curr = before->_next; curr != last; curr = curr->_next, ++count)
+			chainTail = chainTail->_next = create_node(nullptr, std::move(value(curr)));
+	}
+	catch (...)
+	{
+		while (chain._next != nullptr)
+		{
+			NodeBase* next = chain._next->_next;
+			destroy_node(chain._next);
+			chain._next = next;
+		}
+		throw;
+	}
+
+	chainTail->_next = pos->_next;
+	pos->_next = chain._next;
+	if (pos == _tail)
+		_tail = chainTail;
+
+	_size += count;
+	other.erase_after(const_iterator(before), const_iterator(last));
+}
+
+#pragma endregion
+
+#pragma region GetElement
+
+template<typename T, typename Alloc>
+bool ForwardList<T, Alloc>::empty() const noexcept
+{
+	return _size == 0;
+}
+
+template<typename T, typename Alloc>
+size_t ForwardList<T, Alloc>::size() const noexcept
+{
+	return _size;
+}
+
+template<typename T, typename Alloc>
+T& ForwardList<T, Alloc>::front()
+{
+	return value(_head._next);
+}
+
+template<typename T, typename Alloc>
+const T& ForwardList<T, Alloc>::front() const
+{
+	return value(_head._next);
+}
+
+template<typename T, typename Alloc>
+T& ForwardList<T, Alloc>::back()
+{
+	return value(_tail);
+}
+
+template<typename T, typename Alloc>
+const T& ForwardList<T, Alloc>::back() const
+{
+	return value(_tail);
+}
+
+#pragma endregion
+
+#pragma region Xary
+
+template<typename T, typename Alloc>
+void ForwardList<T, Alloc>::clear()
+{
+	NodeBase* curr = _head._next;
+	while (curr != nullptr)
+	{
+		NodeBase* next = curr->_next;
+		destroy_node(curr);
+		curr = next;
+	}
+
+	_head._next = nullptr;
+	_tail = &_head;
+	_size = 0;
+}
+
+template<typename T, typename Alloc>
+void ForwardList<T, Alloc>::push_front(const T& val)
+{
+	emplace_front(val);
+}
+
+template<typename T, typename Alloc>
+void ForwardList<T, Alloc>::push_front(T&& val)
+{
+	emplace_front(std::move(val));
+}
+
+template<typename T, typename Alloc>
+void ForwardList<T, Alloc>::push_back(const T& val)
+{
+	emplace_back(val);
+}
+
+template<typename T, typename Alloc>
+void ForwardList<T, Alloc>::push_back(T&& val)
+{
+	emplace_back(std::move(val));
+}
+
+template<typename T, typename Alloc>
+template<typename... Args>
+T& ForwardList<T, Alloc>::emplace_front(Args&&... args)
+{
+	return *emplace_after(before_begin(), std::forward<Args>(args)...);
+}
+
+template<typename T, typename Alloc>
+template<typename... Args>
+T& ForwardList<T, Alloc>::emplace_back(Args&&... args)
+{
+	return *emplace_after(const_iterator(_tail), std::forward<Args>(args)...);
+}
+
+template<typename T, typename Alloc>
+void ForwardList<T, Alloc>::pop_front()
+{
+	if (_size != 0)
+		erase_after(before_begin());
+}
+
+template<typename T, typename Alloc>
+template<typename... Args>
+ForwardList<T, Alloc>::iterator ForwardList<T, Alloc>::emplace_after(const const_iterator& pos, Args&&... args)
+{
+	NodeBase* prev = const_cast<NodeBase*>(pos._node);
+	Node* node = create_node(prev->_next, std::forward<Args>(args)...);
+
+	prev->_next = node;
+	if (prev == _tail)
+		_tail = node;
+
+	++_size;
+	return iterator(node);
+}
+
+template<typename T, typename Alloc>
+ForwardList<T, Alloc>::iterator ForwardList<T, Alloc>::insert_after(const const_iterator& pos, const T& val)
+{
+	return emplace_after(pos, val);
+}
+
+template<typename T, typename Alloc>
+ForwardList<T, Alloc>::iterator ForwardList<T, Alloc>::insert_after(const const_iterator& pos, T&& val)
+{
+	return emplace_after(pos, std::move(val));
+}
+
+template<typename T, typename Alloc>
+ForwardList<T, Alloc>::iterator ForwardList<T, Alloc>::erase_after(const const_iterator& pos)
+{
+	NodeBase* prev = const_cast<NodeBase*>(pos._node);
+	NodeBase* target = prev->_next;
+
+	prev->_next = target->_next;
+	if (target == _tail)
+		_tail = prev;
+
+	destroy_node(target);
+	--_size;
+
+	return iterator(prev->_next);
+}
+
+// Erases the open range (first, last).
+template<typename T, typename Alloc>
+ForwardList<T, Alloc>::iterator ForwardList<T, Alloc>::erase_after(const const_iterator& first, const const_iterator& last)
+{
+	NodeBase* prev = const_cast<NodeBase*>(first._node);
+	NodeBase* stop = const_cast<NodeBase*>(last._node);
+
+	while (prev->_next != stop)
+		erase_after(first);
+
+	return iterator(stop);
+}
+
+// The splice_after overloads move nodes from other after pos by relinking them,
+// so no element is copied or moved. When the allocators differ, the nodes cannot
+// change owner, so the elements are moved into new nodes instead and iterators
+// to them are invalidated.
+template<typename T, typename Alloc>
+void ForwardList<T, Alloc>::splice_after(const const_iterator& pos, ForwardList& other)
+{
+	if (this == &other || other._size == 0)
+		return;
+
+	NodeBase* prev = const_cast<NodeBase*>(pos._node);
+	if (!shares_nodes(other))
+	{
+		move_nodes(prev, other, &other._head, nullptr);
+		return;
+	}
+
+	other._tail->_next = prev->_next;
+	prev->_next = other._head._next;
+	if (prev == _tail)
+		_tail = other._tail;
+
+	_size += other._size;
+
+	other._head._next = nullptr;
+	other._tail = &other._head;
+	other._size = 0;
+}
+
+template<typename T, typename Alloc>
+void ForwardList<T, Alloc>::splice_after(const const_iterator& pos, ForwardList&& other)
+{
+	splice_after(pos, other);
+}
+
+// Moves the node following before from other to after pos.
+template<typename T, typename Alloc>
+void ForwardList<T, Alloc>::splice_after(const const_iterator& pos, ForwardList& other, const const_iterator& before)
+{
+	NodeBase* prev = const_cast<NodeBase*>(pos._node);
+	NodeBase* from = const_cast<NodeBase*>(before._node);
+	NodeBase* node = from->_next;
+
+	if (prev == from || prev == node)
+		return;
+
+	if (!shares_nodes(other))
+	{
+		move_nodes(prev, other, from, node->_next);
+		return;
+	}
+
+	from->_next = node->_next;
+	if (node == other._tail)
+		other._tail = from;
+
+	node->_next = prev->_next;
+	prev->_next = node;
+	if (prev == _tail)
+		_tail = node;
+
+	--other._size;
+	++_size;
+}
+
+template<typename T, typename Alloc>
+void ForwardList<T, Alloc>::splice_after(const const_iterator& pos, ForwardList&& other, const const_iterator& before)
+{
+	splice_after(pos, other, before);
+}
+
+template<typename T, typename Alloc>
+void ForwardList<T, Alloc>::sort()
+{
+	sort(std::less<>());
+}
+
+// The same bottom-up merge sort as List::sort: stable, O(n log n), relinks nodes
+// only. The tail is found again once the final chain is built.
+template<typename T, typename Alloc>
+template<typename Compare>
+void ForwardList<T, Alloc>::sort(Compare comp)
+{
+	if (_size < 2)
+		return;
+
+	auto less = [&comp](const NodeBase* lhs, const NodeBase* rhs) { return comp(value(lhs), value(rhs)); };
+	NodeBase* sorted = detail::sort_chain(_head._next, less);
+
+	_head._next = sorted;
+	_tail = sorted;
+	while (_tail->_next != nullptr)
+		_tail = _tail->_next;
+}
+
+template<typename T, typename Alloc>
+void ForwardList<T, Alloc>::swap(ForwardList& other)
+{
+	if constexpr (AllocTraits::propagate_on_container_swap::value)
+	{
+		using std::swap;
+		swap(_alloc, other._alloc);
+	}
+	else if (!shares_nodes(other))
+	{
+		// Each list keeps its allocator and its nodes: the common prefix swaps
+		// values, and the longer list's surplus is moved over into new nodes.
+		NodeBase* prev = &_head;
+		NodeBase* otherPrev = &other._head;
+		for (; prev->_next != nullptr && otherPrev->_next != nullptr; prev = prev->_next, otherPrev = otherPrev->_next)
+		{
+			using std::swap;
+			swap(value(prev->_next), value(otherPrev->_next));
+		}
+
+		if (prev->_next != nullptr)
+			other.move_nodes(other._tail, *this, prev, nullptr);
+		else
+			move_nodes(_tail, other, otherPrev, nullptr);
+
+		return;
+	}
+
+	swap_nodes(other);
+}
+
+#pragma endregion
+
+#pragma region Operators
+
+template<typename T, typename Alloc>
+bool operator==(const ForwardList<T, Alloc>& lhs, const ForwardList<T, Alloc>& rhs)
+{
+	if (lhs._size != rhs._size)
+		return false;
+
+	auto rhsIter = rhs.begin();
+	for (const T& val : lhs)
+	{
+		if (!(val == *rhsIter))
+			return false;
+
+		++rhsIter;
+	}
+
+	return true;
+}
+
+template<typename T, typename Alloc>
+bool operator!=(const ForwardList<T, Alloc>& lhs, const ForwardList<T, Alloc>& rhs)
+{
+	return !(lhs == rhs);
+}
+
+template<typename T, typename Alloc>
+void swap(ForwardList<T, Alloc>& lhs, ForwardList<T, Alloc>& rhs)
+{
+	lhs.swap(rhs);
+}
+
+template<typename T, typename Alloc>
+ForwardList<T, Alloc>& ForwardList<T, Alloc>::operator=(const ForwardList& other)
+{
+	if (this == &other) return *this;
+
+	clear();
+
+	if constexpr (AllocTraits::propagate_on_container_copy_assignment::value)
+		_alloc = other._alloc;
+
+	for (const T& val : other)
+		emplace_back(val);
+
+	return *this;
+}
+
+template<typename T, typename Alloc>
+ForwardList<T, Alloc>& ForwardList<T, Alloc>::operator=(ForwardList&& other) noexcept(AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value)
+{
+	if (this == &other) return *this;
+
+	clear();
+
+	if constexpr (AllocTraits::propagate_on_container_move_assignment::value)
+	{
+		using std::swap;
+		swap(_alloc, other._alloc);
+	}
+	else if (!AllocTraits::is_always_equal::value && _alloc != other._alloc)
+	{
+		for (T& val : other)
+			emplace_back(std::move(val));
+
+		other.clear();
+		return *this;
+	}
+
+	swap_nodes(other);
+	return *this;
+}
+
+#pragma endregion
+
+#pragma region Iterator
+
+template<typename T, typename Alloc>
+ForwardList<T, Alloc>::iterator ForwardList<T, Alloc>::before_begin()
+{
+	return iterator(&_head);
+}
+
+template<typename T, typename Alloc>
+ForwardList<T, Alloc>::iterator ForwardList<T, Alloc>::begin()
+{
+	return iterator(_head._next);
+}
+
+template<typename T, typename Alloc>
+ForwardList<T, Alloc>::iterator ForwardList<T, Alloc>::end()
+{
+	return iterator(nullptr);
+}
+
+template<typename T, typename Alloc>
+ForwardList<T, Alloc>::iterator::reference ForwardList<T, Alloc>::iterator::operator*() const
+{
+	return value(_node);
+}
+
+template<typename T, typename Alloc>
+ForwardList<T, Alloc>::iterator::pointer ForwardList<T, Alloc>::iterator::operator->() const
+{
+	return std::addressof(value(_node));
+}
+
+template<typename T, typename Alloc>
+ForwardList<T, Alloc>::iterator& ForwardList<T, Alloc>::iterator::operator++()
+{
+	_node = _node->_next;
+	return *this;
+}
+
+template<typename T, typename Alloc>
+ForwardList<T, Alloc>::iterator ForwardList<T, Alloc>::iterator::operator++(int)
+{
+	iterator result(*this);
+	++(*this);
+	return result;
+}
+
+template<typename T, typename Alloc>
+bool ForwardList<T, Alloc>::iterator::operator==(const iterator& other) const
+{
+	return _node == other._node;
+}
+
+template<typename T, typename Alloc>
+bool ForwardList<T, Alloc>::iterator::operator!=(const iterator& other) const
+{
+	return !(*this == other);
+}
+
+#pragma endregion
+
+#pragma region Const Iterator
+
+template<typename T, typename Alloc>
+ForwardList<T, Alloc>::const_iterator ForwardList<T, Alloc>::before_begin() const
+{
+	return const_iterator(&_head);
+}
+
+template<typename T, typename Alloc>
+ForwardList<T, Alloc>::const_iterator ForwardList<T, Alloc>::cbefore_begin() const
+{
+	return before_begin();
+}
+
+template<typename T, typename Alloc>
+ForwardList<T, Alloc>::const_iterator ForwardList<T, Alloc>::begin() const
+{
+	return const_iterator(_head._next);
+}
+
+template<typename T, typename Alloc>
+ForwardList<T, Alloc>::const_iterator ForwardList<T, Alloc>::end() const
+{
+	return const_iterator(nullptr);
+}
+
+template<typename T, typename Alloc>
+ForwardList<T, Alloc>::const_iterator ForwardList<T, Alloc>::cbegin() const
+{
+	return begin();
+}
+
+template<typename T, typename Alloc>
+ForwardList<T, Alloc>::const_iterator ForwardList<T, Alloc>::cend() const
+{
+	return end();
+}
+
+template<typename T, typename Alloc>
+ForwardList<T, Alloc>::const_iterator::reference ForwardList<T, Alloc>::const_iterator::operator*() const
+{
+	return value(_node);
+}
+
+template<typename T, typename Alloc>
+ForwardList<T, Alloc>::const_iterator::pointer ForwardList<T, Alloc>::const_iterator::operator->() const
+{
+	return std::addressof(value(_node));
+}
+
+template<typename T, typename Alloc>
+ForwardList<T, Alloc>::const_iterator& ForwardList<T, Alloc>::const_iterator::operator++()
+{
+	_node = _node->_next;
+	return *this;
+}
+
+template<typename T, typename Alloc>
+ForwardList<T, Alloc>::const_iterator ForwardList<T, Alloc>::const_iterator::operator++(int)
+{
+	const_iterator result(*this);
+	++(*this);
+	return result;
+}
+
+template<typename T, typename Alloc>
+bool ForwardList<T, Alloc>::const_iterator::operator==(const const_iterator& other) const
+{
+	return _node == other._node;
+}
+
+template<typename T, typename Alloc>
+bool ForwardList<T, Alloc>::const_iterator::operator!=(const const_iterator& other) const
+{
+	return !(*this == other);
+}
+
+#pragma endregion
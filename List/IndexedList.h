@@ -0,0 +1,1112 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+// Doubly linked list with a skip-list index over its nodes, for positional access.
+// Every node sits on the base chain; about one in four also carries an index entry
+// one level up, one in sixteen two levels up, and so on. Each index entry records
+// how many elements lie between it and the next entry on its level, so at(k),
+// iterator_at(k), index_of(it) and insert_at(k, val) take expected O(log n) steps.
+//
+// Iteration walks the base chain exactly like List, and iterators stay valid until
+// their element is erased. Inserting or erasing at an iterator also keeps the index
+// up to date, which makes it expected O(log n) rather than O(1).
+template <typename T, typename Alloc = std::allocator<T>>
+class IndexedList
+{
+public:
+
+	using allocator_type = Alloc;
+
+	// Enough levels for 4^32 elements.
+	static constexpr size_t max_levels = 32;
+
+private:
+
+#pragma region Node
+
+	struct Index;
+
+	struct NodeBase
+	{
+		NodeBase* _next;
+		NodeBase* _prev;
+		Index* _up;
+
+		NodeBase(NodeBase* next = nullptr, NodeBase* prev = nullptr);
+	};
+
+	struct Node : NodeBase
+	{
+		union
+		{
+			T _val;
+		};
+
+		Node();
+		~Node();
+	};
+
+	// One entry of the index. The sentinel owns a tower of head entries, one per
+	// level, which start each level at rank 0. _width is the rank distance to the
+	// next entry on the level, or to end() for the last one.
+	struct Index
+	{
+		Index* _next;
+		Index* _prev;
+		Index* _up;
+		Index* _down;
+		NodeBase* _node;
+		size_t _width;
+	};
+
+	using AllocTraits = std::allocator_traits<Alloc>;
+	using NodeAlloc = typename AllocTraits::template rebind_alloc<Node>;
+	using NodeTraits = std::allocator_traits<NodeAlloc>;
+	using IndexAlloc = typename AllocTraits::template rebind_alloc<Index>;
+	using IndexTraits = std::allocator_traits<IndexAlloc>;
+
+	static T& value(NodeBase* node);
+	static const T& value(const NodeBase* node);
+
+	template <typename... Args>
+	Node* create_node(Args&&... args);
+	void destroy_node(NodeBase* node);
+	Index* create_index(NodeBase* node, Index* down, size_t width);
+	void destroy_index(Index* idx);
+
+	size_t random_height();
+	void add_level();
+	void drop_level();
+	size_t climb(const NodeBase* node, Index** preds = nullptr, size_t* offsets = nullptr) const;
+	NodeBase* node_at(size_t rank) const;
+	NodeBase* link(NodeBase* next, Node* node);
+	NodeBase* unlink(NodeBase* node);
+	void swap_nodes(IndexedList& other) noexcept;
+
+	[[no_unique_address]] NodeAlloc _alloc;
+	[[no_unique_address]] IndexAlloc _indexAlloc;
+	NodeBase _sentinel;
+	Index* _top;
+	size_t _levels;
+	size_t _size;
+	uint64_t _seed;
+
+#pragma endregion
+
+public:
+
+#pragma region Iterator
+
+	class iterator
+	{
+	public:
+		using value_type = T;
+		using difference_type = std::ptrdiff_t;
+		using pointer = T*;
+		using reference = T&;
+		using iterator_category = std::bidirectional_iterator_tag;
+
+	private:
+		NodeBase* _node;
+
+	public:
+		iterator(NodeBase* node = nullptr);
+
+		reference operator*() const;
+		pointer operator->() const;
+		iterator& operator++();
+		iterator operator++(int);
+		iterator& operator--();
+		iterator operator--(int);
+		bool operator==(const iterator& other) const;
+		bool operator!=(const iterator& other) const;
+
+		friend class const_iterator;
+		friend class IndexedList;
+	};
+
+	static_assert(std::bidirectional_iterator<iterator>);
+
+#pragma endregion
+
+#pragma region Const Iterator
+
+	class const_iterator
+	{
+	public:
+		using value_type = T;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const T*;
+		using reference = const T&;
+		using iterator_category = std::bidirectional_iterator_tag;
+
+	private:
+		const NodeBase* _node;
+
+	public:
+		const_iterator(const NodeBase* node = nullptr);
+		const_iterator(const iterator& iter);
+
+		reference operator*() const;
+		pointer operator->() const;
+		const_iterator& operator++();
+		const_iterator operator++(int);
+		const_iterator& operator--();
+		const_iterator operator--(int);
+		bool operator==(const const_iterator& other) const;
+		bool operator!=(const const_iterator& other) const;
+
+		friend class IndexedList;
+	};
+
+	static_assert(std::bidirectional_iterator<const_iterator>);
+
+#pragma endregion
+
+	using reverse_iterator = std::reverse_iterator<iterator>;
+	using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+	IndexedList() noexcept(noexcept(Alloc()));
+	explicit IndexedList(const Alloc& alloc) noexcept;
+	IndexedList(std::initializer_list<T> initList, const Alloc& alloc = Alloc());
+	template <std::input_iterator iter>
+	IndexedList(iter begin, iter end, const Alloc& alloc = Alloc());
+	IndexedList(const IndexedList& other);
+	IndexedList(IndexedList&& other) noexcept;
+	~IndexedList();
+
+	allocator_type get_allocator() const;
+
+	bool empty() const noexcept;
+	size_t size() const noexcept;
+	T& front();
+	const T& front() const;
+	T& back();
+	const T& back() const;
+	T& at(size_t index);
+	const T& at(size_t index) const;
+	T& operator[](size_t index);
+	const T& operator[](size_t index) const;
+	iterator iterator_at(size_t index);
+	const_iterator iterator_at(size_t index) const;
+	size_t index_of(const const_iterator& pos) const;
+	void clear();
+
+	void push_front(const T& val);
+	void push_front(T&& val);
+	void push_back(const T& val);
+	void push_back(T&& val);
+	template <typename... Args>
+	T& emplace_back(Args&&... args);
+	void pop_front();
+	void pop_back();
+	template <typename... Args>
+	iterator emplace(const const_iterator& pos, Args&&... args);
+	iterator insert(const const_iterator& pos, const T& val);
+	iterator insert(const const_iterator& pos, T&& val);
+	iterator insert_at(size_t index, const T& val);
+	iterator insert_at(size_t index, T&& val);
+	iterator erase(const const_iterator& pos);
+	iterator erase_at(size_t index);
+	void swap(IndexedList& other);
+
+	iterator begin();
+	iterator end();
+	const_iterator begin() const;
+	const_iterator end() const;
+	const_iterator cbegin() const;
+	const_iterator cend() const;
+	reverse_iterator rbegin();
+	reverse_iterator rend();
+	const_reverse_iterator rbegin() const;
+	const_reverse_iterator rend() const;
+	const_reverse_iterator crbegin() const;
+	const_reverse_iterator crend() const;
+
+	IndexedList& operator=(const IndexedList& other);
+	IndexedList& operator=(IndexedList&& other) noexcept(AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value);
+
+	template <typename U, typename A>
+	friend bool operator==(const IndexedList<U, A>& lhs, const IndexedList<U, A>& rhs);
+
+};
+
+#pragma region CtorsAndDestructors
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::IndexedList() noexcept(noexcept(Alloc())) : IndexedList(Alloc()) { }
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::IndexedList(const Alloc& alloc) noexcept
+	: _alloc(alloc), _indexAlloc(alloc), _sentinel(&_sentinel, &_sentinel), _top(nullptr), _levels(0), _size(0), _seed(0x2545F4914F6CDD1D) { }
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::IndexedList(std::initializer_list<T> initList, const Alloc& alloc)
+	: IndexedList(initList.begin(), initList.end(), alloc) { }
+
+template<typename T, typename Alloc>
+template<std::input_iterator iter>
+IndexedList<T, Alloc>::IndexedList(iter begin, iter end, const Alloc& alloc) : IndexedList(alloc)
+{
+	try
+	{
+		for (auto it = begin; it != end; ++it)
+			emplace_back(*it);
+	}
+	catch (...)
+	{
+		clear();
+		throw;
+	}
+}
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::IndexedList(const IndexedList& other)
+	: IndexedList(other.begin(), other.end(), AllocTraits::select_on_container_copy_construction(other.get_allocator())) { }
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::IndexedList(IndexedList&& other) noexcept : IndexedList(other.get_allocator())
+{
+	swap_nodes(other);
+}
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::~IndexedList()
+{
+	clear();
+}
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::allocator_type IndexedList<T, Alloc>::get_allocator() const
+{
+	return allocator_type(_alloc);
+}
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::NodeBase::NodeBase(NodeBase* next, NodeBase* prev) : _next(next), _prev(prev), _up(nullptr) { }
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::Node::Node() : NodeBase() { }
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::Node::~Node() { }
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::iterator::iterator(NodeBase* node) : _node(node) { }
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::const_iterator::const_iterator(const NodeBase* node) : _node(node) { }
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::const_iterator::const_iterator(const iterator& iter) : _node(iter._node) { }
+
+#pragma endregion
+
+#pragma region Node
+
+template<typename T, typename Alloc>
+T& IndexedList<T, Alloc>::value(NodeBase* node)
+{
+	return static_cast<Node*>(node)->_val;
+}
+
+template<typename T, typename Alloc>
+const T& IndexedList<T, Alloc>::value(const NodeBase* node)
+{
+	return static_cast<const Node*>(node)->_val;
+}
+
+// Builds an unlinked node, so a throwing constructor leaves the list as it was.
+template<typename T, typename Alloc>
+template<typename... Args>
+IndexedList<T, Alloc>::Node* IndexedList<T, Alloc>::create_node(Args&&... args)
+{
+	Node* node = NodeTraits::allocate(_alloc, 1);
+	::new (static_cast<void*>(node)) Node();
+
+	try
+	{
+		NodeTraits::construct(_alloc, std::addressof(node->_val), std::forward<Args>(args)...);
+	}
+	catch (...)
+	{
+		node->~Node();
+		NodeTraits::deallocate(_alloc, node, 1);
+		throw;
+	}
+
+	return node;
+}
+
+template<typename T, typename Alloc>
+void IndexedList<T, Alloc>::destroy_node(NodeBase* node)
+{
+	Node* p = static_cast<Node*>(node);
+	NodeTraits::destroy(_alloc, std::addressof(p->_val));
+	p->~Node();
+	NodeTraits::deallocate(_alloc, p, 1);
+}
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::Index* IndexedList<T, Alloc>::create_index(NodeBase* node, Index* down, size_t width)
+{
+	Index* idx = IndexTraits::allocate(_indexAlloc, 1);
+	::new (static_cast<void*>(idx)) Index{ nullptr, nullptr, nullptr, down, node, width };
+	return idx;
+}
+
+template<typename T, typename Alloc>
+void IndexedList<T, Alloc>::destroy_index(Index* idx)
+{
+	idx->~Index();
+	IndexTraits::deallocate(_indexAlloc, idx, 1);
+}
+
+// Number of index levels for a new node: k or more with probability 4^-k.
+template<typename T, typename Alloc>
+size_t IndexedList<T, Alloc>::random_height()
+{
+	uint64_t bits = (_seed += 0x9E3779B97F4A7C15);
+	bits = (bits ^ (bits >> 30)) * 0xBF58476D1CE4E5B9;
+	bits = (bits ^ (bits >> 27)) * 0x94D049BB133111EB;
+	bits ^= bits >> 31;
+
+	return std::countr_zero(bits | (uint64_t(1) << 63)) / 2;
+}
+
+// Puts a new, empty level on top of the head tower.
+template<typename T, typename Alloc>
+void IndexedList<T, Alloc>::add_level()
+{
+	Index* head = create_index(&_sentinel, _top, _size + 1);
+
+	if (_top != nullptr)
+		_top->_up = head;
+	else
+		_sentinel._up = head;
+
+	_top = head;
+	++_levels;
+}
+
+template<typename T, typename Alloc>
+void IndexedList<T, Alloc>::drop_level()
+{
+	Index* head = _top;
+	_top = head->_down;
+
+	if (_top != nullptr)
+		_top->_up = nullptr;
+	else
+		_sentinel._up = nullptr;
+
+	destroy_index(head);
+	--_levels;
+}
+
+// Walks from node back to the head tower and returns its rank: 0 for the sentinel,
+// k + 1 for the k-th element. With preds, also stores for every level the last
+// entry at or before node, and in offsets how many ranks that entry lies behind it.
+template<typename T, typename Alloc>
+size_t IndexedList<T, Alloc>::climb(const NodeBase* node, Index** preds, size_t* offsets) const
+{
+	size_t rank = 0;
+	while (node != &_sentinel && node->_up == nullptr)
+	{
+		node = node->_prev;
+		++rank;
+	}
+
+	Index* idx = node->_up;
+	for (size_t level = 0; idx != nullptr; ++level)
+	{
+		if (preds != nullptr)
+		{
+			preds[level] = idx;
+			offsets[level] = rank;
+		}
+
+		while (idx->_up == nullptr && idx->_prev != nullptr)
+		{
+			idx = idx->_prev;
+			rank += idx->_width;
+		}
+
+		idx = idx->_up;
+	}
+
+	return rank;
+}
+
+// Descends the index to the node with the given rank, which must be at most size().
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::NodeBase* IndexedList<T, Alloc>::node_at(size_t rank) const
+{
+	NodeBase* node = const_cast<NodeBase*>(&_sentinel);
+	size_t current = 0;
+
+	if (_top != nullptr)
+	{
+		Index* idx = _top;
+		while (true)
+		{
+			while (idx->_next != nullptr && current + idx->_width <= rank)
+			{
+				current += idx->_width;
+				idx = idx->_next;
+			}
+
+			if (idx->_down == nullptr)
+				break;
+
+			idx = idx->_down;
+		}
+
+		node = idx->_node;
+	}
+
+	for (; current < rank; ++current)
+		node = node->_next;
+
+	return node;
+}
+
+// Links node in front of next and gives it a random tower of index entries. All
+// entries are allocated before anything is relinked; if that fails, node is freed
+// and the list is left as it was.
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::NodeBase* IndexedList<T, Alloc>::link(NodeBase* next, Node* node)
+{
+	size_t height = std::min(random_height(), _levels + 1);
+	Index* tower[max_levels];
+	size_t built = 0;
+
+	try
+	{
+		if (height > _levels)
+			add_level();
+
+		for (; built < height; ++built)
+			tower[built] = create_index(node, built == 0 ? nullptr : tower[built - 1], 0);
+	}
+	catch (...)
+	{
+		while (built > 0)
+			destroy_index(tower[--built]);
+
+		destroy_node(node);
+		throw;
+	}
+
+	Index* preds[max_levels];
+	size_t offsets[max_levels];
+	climb(next->_prev, preds, offsets);
+
+	for (size_t level = 0; level < _levels; ++level)
+	{
+		Index* pred = preds[level];
+		if (level >= height)
+		{
+			++pred->_width;
+			continue;
+		}
+
+		Index* idx = tower[level];
+		idx->_width = pred->_width - offsets[level];
+		pred->_width = offsets[level] + 1;
+
+		idx->_prev = pred;
+		idx->_next = pred->_next;
+		if (idx->_next != nullptr)
+			idx->_next->_prev = idx;
+		pred->_next = idx;
+
+		if (level > 0)
+			tower[level - 1]->_up = idx;
+	}
+
+	node->_up = height > 0 ? tower[0] : nullptr;
+	node->_next = next;
+	node->_prev = next->_prev;
+	next->_prev->_next = node;
+	next->_prev = node;
+
+	++_size;
+	return node;
+}
+
+// Unlinks node and its index entries, frees it and returns the node that followed.
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::NodeBase* IndexedList<T, Alloc>::unlink(NodeBase* node)
+{
+	Index* preds[max_levels];
+	size_t offsets[max_levels];
+	climb(node, preds, offsets);
+
+	for (size_t level = 0; level < _levels; ++level)
+	{
+		Index* idx = preds[level];
+		if (idx->_node != node)
+		{
+			--idx->_width;
+			continue;
+		}
+
+		idx->_prev->_width += idx->_width - 1;
+		idx->_prev->_next = idx->_next;
+		if (idx->_next != nullptr)
+			idx->_next->_prev = idx->_prev;
+
+		destroy_index(idx);
+	}
+
+	while (_top != nullptr && _top->_next == nullptr)
+		drop_level();
+
+	NodeBase* next = node->_next;
+	node->_prev->_next = next;
+	next->_prev = node->_prev;
+	destroy_node(node);
+
+	--_size;
+	return next;
+}
+
+// Exchanges the node chains and index towers of two lists. The first and last
+// nodes and the head entries point at the sentinel of the list that owns them,
+// so those links are re-aimed.
+template<typename T, typename Alloc>
+void IndexedList<T, Alloc>::swap_nodes(IndexedList& other) noexcept
+{
+	std::swap(_sentinel._next, other._sentinel._next);
+	std::swap(_sentinel._prev, other._sentinel._prev);
+	std::swap(_sentinel._up, other._sentinel._up);
+	std::swap(_top, other._top);
+	std::swap(_levels, other._levels);
+	std::swap(_size, other._size);
+
+	for (IndexedList* lst : { this, &other })
+	{
+		if (lst->_size == 0)
+			lst->_sentinel._next = lst->_sentinel._prev = &lst->_sentinel;
+		else
+			lst->_sentinel._next->_prev = lst->_sentinel._prev->_next = &lst->_sentinel;
+
+		for (Index* head = lst->_sentinel._up; head != nullptr; head = head->_up)
+			head->_node = &lst->_sentinel;
+	}
+}
+
+#pragma endregion
+
+#pragma region GetElement
+
+template<typename T, typename Alloc>
+bool IndexedList<T, Alloc>::empty() const noexcept
+{
+	return _size == 0;
+}
+
+template<typename T, typename Alloc>
+size_t IndexedList<T, Alloc>::size() const noexcept
+{
+	return _size;
+}
+
+template<typename T, typename Alloc>
+T& IndexedList<T, Alloc>::front()
+{
+	return value(_sentinel._next);
+}
+
+template<typename T, typename Alloc>
+const T& IndexedList<T, Alloc>::front() const
+{
+	return value(_sentinel._next);
+}
+
+template<typename T, typename Alloc>
+T& IndexedList<T, Alloc>::back()
+{
+	return value(_sentinel._prev);
+}
+
+template<typename T, typename Alloc>
+const T& IndexedList<T, Alloc>::back() const
+{
+	return value(_sentinel._prev);
+}
+
+template<typename T, typename Alloc>
+T& IndexedList<T, Alloc>::at(size_t index)
+{
+	if (index >= _size)
+		throw std::out_of_range("IndexedList::at index out of range");
+
+	return value(node_at(index + 1));
+}
+
+template<typename T, typename Alloc>
+const T& IndexedList<T, Alloc>::at(size_t index) const
+{
+	if (index >= _size)
+		throw std::out_of_range("IndexedList::at index out of range");
+
+	return value(node_at(index + 1));
+}
+
+template<typename T, typename Alloc>
+T& IndexedList<T, Alloc>::operator[](size_t index)
+{
+	return value(node_at(index + 1));
+}
+
+template<typename T, typename Alloc>
+const T& IndexedList<T, Alloc>::operator[](size_t index) const
+{
+	return value(node_at(index + 1));
+}
+
+// An index of size() or more gives end().
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::iterator IndexedList<T, Alloc>::iterator_at(size_t index)
+{
+	return index < _size ? iterator(node_at(index + 1)) : end();
+}
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::const_iterator IndexedList<T, Alloc>::iterator_at(size_t index) const
+{
+	return index < _size ? const_iterator(node_at(index + 1)) : end();
+}
+
+// end() has index size().
+template<typename T, typename Alloc>
+size_t IndexedList<T, Alloc>::index_of(const const_iterator& pos) const
+{
+	return pos._node == &_sentinel ? _size : climb(pos._node) - 1;
+}
+
+#pragma endregion
+
+#pragma region Xary
+
+template<typename T, typename Alloc>
+void IndexedList<T, Alloc>::clear()
+{
+	while (_top != nullptr)
+	{
+		Index* idx = _top->_next;
+		while (idx != nullptr)
+		{
+			Index* next = idx->_next;
+			destroy_index(idx);
+			idx = next;
+		}
+
+		drop_level();
+	}
+
+	NodeBase* node = _sentinel._next;
+	while (node != &_sentinel)
+	{
+		NodeBase* next = node->_next;
+		destroy_node(node);
+		node = next;
+	}
+
+	_sentinel._next = _sentinel._prev = &_sentinel;
+	_size = 0;
+}
+
+template<typename T, typename Alloc>
+void IndexedList<T, Alloc>::push_front(const T& val)
+{
+	emplace(begin(), val);
+}
+
+template<typename T, typename Alloc>
+void IndexedList<T, Alloc>::push_front(T&& val)
+{
+	emplace(begin(), std::move(val));
+}
+
+template<typename T, typename Alloc>
+void IndexedList<T, Alloc>::push_back(const T& val)
+{
+	emplace(end(), val);
+}
+
+template<typename T, typename Alloc>
+void IndexedList<T, Alloc>::push_back(T&& val)
+{
+	emplace(end(), std::move(val));
+}
+
+template<typename T, typename Alloc>
+template<typename... Args>
+T& IndexedList<T, Alloc>::emplace_back(Args&&... args)
+{
+	return *emplace(end(), std::forward<Args>(args)...);
+}
+
+template<typename T, typename Alloc>
+void IndexedList<T, Alloc>::pop_front()
+{
+	if (_size != 0)
+		unlink(_sentinel._next);
+}
+
+template<typename T, typename Alloc>
+void IndexedList<T, Alloc>::pop_back()
+{
+	if (_size != 0)
+		unlink(_sentinel._prev);
+}
+
+template<typename T, typename Alloc>
+template<typename... Args>
+IndexedList<T, Alloc>::iterator IndexedList<T, Alloc>::emplace(const const_iterator& pos, Args&&... args)
+{
+	Node* node = create_node(std::forward<Args>(args)...);
+	return iterator(link(const_cast<NodeBase*>(pos._node), node));
+}
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::iterator IndexedList<T, Alloc>::insert(const const_iterator& pos, const T& val)
+{
+	return emplace(pos, val);
+}
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::iterator IndexedList<T, Alloc>::insert(const const_iterator& pos, T&& val)
+{
+	return emplace(pos, std::move(val));
+}
+
+// Inserts so that the new element ends up at index; an index past the end appends.
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::iterator IndexedList<T, Alloc>::insert_at(size_t index, const T& val)
+{
+	Node* node = create_node(val);
+	return iterator(link(index < _size ? node_at(index + 1) : &_sentinel, node));
+}
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::iterator IndexedList<T, Alloc>::insert_at(size_t index, T&& val)
+{
+	Node* node = create_node(std::move(val));
+	return iterator(link(index < _size ? node_at(index + 1) : &_sentinel, node));
+}
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::iterator IndexedList<T, Alloc>::erase(const const_iterator& pos)
+{
+	return iterator(unlink(const_cast<NodeBase*>(pos._node)));
+}
+
+// Unlike insert_at, the index is checked like at(): erase_at(size()) would
+// otherwise unlink the sentinel.
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::iterator IndexedList<T, Alloc>::erase_at(size_t index)
+{
+	if (index >= _size)
+		throw std::out_of_range("IndexedList::erase_at index out of range");
+
+	return iterator(unlink(node_at(index + 1)));
+}
+
+template<typename T, typename Alloc>
+void IndexedList<T, Alloc>::swap(IndexedList& other)
+{
+	if constexpr (AllocTraits::propagate_on_container_swap::value)
+	{
+		using std::swap;
+		swap(_alloc, other._alloc);
+		swap(_indexAlloc, other._indexAlloc);
+	}
+
+	swap_nodes(other);
+}
+
+#pragma endregion
+
+#pragma region Operators
+
+template<typename T, typename Alloc>
+bool operator==(const IndexedList<T, Alloc>& lhs, const IndexedList<T, Alloc>& rhs)
+{
+	if (lhs._size != rhs._size)
+		return false;
+
+	auto rhsIter = rhs.begin();
+	for (const T& val : lhs)
+	{
+		if (!(val == *rhsIter))
+			return false;
+
+		++rhsIter;
+	}
+
+	return true;
+}
+
+template<typename T, typename Alloc>
+bool operator!=(const IndexedList<T, Alloc>& lhs, const IndexedList<T, Alloc>& rhs)
+{
+	return !(lhs == rhs);
+}
+
+template<typename T, typename Alloc>
+void swap(IndexedList<T, Alloc>& lhs, IndexedList<T, Alloc>& rhs)
+{
+	lhs.swap(rhs);
+}
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>& IndexedList<T, Alloc>::operator=(const IndexedList& other)
+{
+	if (this == &other) return *this;
+
+	clear();
+
+	if constexpr (AllocTraits::propagate_on_container_copy_assignment::value)
+	{
+		_alloc = other._alloc;
+		_indexAlloc = other._indexAlloc;
+	}
+
+	for (const T& val : other)
+		emplace_back(val);
+
+	return *this;
+}
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>& IndexedList<T, Alloc>::operator=(IndexedList&& other) noexcept(AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value)
+{
+	if (this == &other) return *this;
+
+	clear();
+
+	if constexpr (AllocTraits::propagate_on_container_move_assignment::value)
+	{
+		using std::swap;
+		swap(_alloc, other._alloc);
+		swap(_indexAlloc, other._indexAlloc);
+	}
+	else if (!AllocTraits::is_always_equal::value && _alloc != other._alloc)
+	{
+		for (T& val : other)
+			emplace_back(std::move(val));
+
+		other.clear();
+		return *this;
+	}
+
+	swap_nodes(other);
+	return *this;
+}
+
+#pragma endregion
+
+#pragma region Iterator
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::iterator IndexedList<T, Alloc>::begin()
+{
+	return iterator(_sentinel._next);
+}
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::iterator IndexedList<T, Alloc>::end()
+{
+	return iterator(&_sentinel);
+}
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::iterator::reference IndexedList<T, Alloc>::iterator::operator*() const
+{
+	return value(_node);
+}
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::iterator::pointer IndexedList<T, Alloc>::iterator::operator->() const
+{
+	return std::addressof(value(_node));
+}
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::iterator& IndexedList<T, Alloc>::iterator::operator++()
+{
+	_node = _node->_next;
+	return *this;
+}
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::iterator IndexedList<T, Alloc>::iterator::operator++(int)
+{
+	iterator result(*this);
+	++(*this);
+	return result;
+}
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::iterator& IndexedList<T, Alloc>::iterator::operator--()
+{
+	_node = _node->_prev;
+	return *this;
+}
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::iterator IndexedList<T, Alloc>::iterator::operator--(int)
+{
+	iterator result(*this);
+	--(*this);
+	return result;
+}
+
+template<typename T, typename Alloc>
+bool IndexedList<T, Alloc>::iterator::operator==(const iterator& other) const
+{
+	return _node == other._node;
+}
+
+template<typename T, typename Alloc>
+bool IndexedList<T, Alloc>::iterator::operator!=(const iterator& other) const
+{
+	return !(*this == other);
+}
+
+#pragma endregion
+
+#pragma region Const Iterator
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::const_iterator IndexedList<T, Alloc>::begin() const
+{
+	return const_iterator(_sentinel._next);
+}
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::const_iterator IndexedList<T, Alloc>::end() const
+{
+	return const_iterator(&_sentinel);
+}
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::const_iterator IndexedList<T, Alloc>::cbegin() const
+{
+	return begin();
+}
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::const_iterator IndexedList<T, Alloc>::cend() const
+{
+	return end();
+}
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::const_iterator::reference IndexedList<T, Alloc>::const_iterator::operator*() const
+{
+	return value(_node);
+}
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::const_iterator::pointer IndexedList<T, Alloc>::const_iterator::operator->() const
+{
+	return std::addressof(value(_node));
+}
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::const_iterator& IndexedList<T, Alloc>::const_iterator::operator++()
+{
+	_node = _node->_next;
+	return *this;
+}
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::const_iterator IndexedList<T, Alloc>::const_iterator::operator++(int)
+{
+	const_iterator result(*this);
+	++(*this);
+	return result;
+}
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::const_iterator& IndexedList<T, Alloc>::const_iterator::operator--()
+{
+	_node = _node->_prev;
+	return *this;
+}
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::const_iterator IndexedList<T, Alloc>::const_iterator::operator--(int)
+{
+	const_iterator result(*this);
+	--(*this);
+	return result;
+}
+
+template<typename T, typename Alloc>
+bool IndexedList<T, Alloc>::const_iterator::operator==(const const_iterator& other) const
+{
+	return _node == other._node;
+}
+
+template<typename T, typename Alloc>
+bool IndexedList<T, Alloc>::const_iterator::operator!=(const const_iterator& other) const
+{
+	return !(*this == other);
+}
+
+#pragma endregion
+
+#pragma region Reverse Iterator
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::reverse_iterator IndexedList<T, Alloc>::rbegin()
+{
+	return reverse_iterator(end());
+}
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::reverse_iterator IndexedList<T, Alloc>::rend()
+{
+	return reverse_iterator(begin());
+}
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::const_reverse_iterator IndexedList<T, Alloc>::rbegin() const
+{
+	return const_reverse_iterator(end());
+}
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::const_reverse_iterator IndexedList<T, Alloc>::rend() const
+{
+	return const_reverse_iterator(begin());
+}
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::const_reverse_iterator IndexedList<T, Alloc>::crbegin() const
+{
+	return rbegin();
+}
+
+template<typename T, typename Alloc>
+IndexedList<T, Alloc>::const_reverse_iterator IndexedList<T, Alloc>::crend() const
+{
+	return rend();
+}
+
+#pragma endregion
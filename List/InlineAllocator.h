@@ -0,0 +1,214 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace detail
+{
+
+#pragma region InlineArena
+
+	// Hands out fixed-size blocks from a buffer owned by someone else, typically a
+	// container object. Blocks are carved from the buffer front to back and then
+	// recycled through an intrusive free list. Not thread-safe.
+	class InlineArena
+	{
+
+	private:
+
+		struct FreeBlock
+		{
+			FreeBlock* _next;
+		};
+
+		std::byte* _begin;
+		std::byte* _end;
+		std::byte* _unused;
+		size_t _blockSize;
+		size_t _alignment;
+		FreeBlock* _free;
+
+	public:
+
+		InlineArena(std::byte* buffer, size_t blockSize, size_t alignment, size_t blocks);
+		InlineArena(const InlineArena&) = delete;
+		InlineArena& operator=(const InlineArena&) = delete;
+
+		// Returns nullptr when the arena is full or the request does not fit a block.
+		void* allocate(size_t size, size_t alignment);
+		void deallocate(void* block);
+		bool owns(const void* ptr) const;
+		size_t free_blocks() const;
+	};
+
+#pragma endregion
+
+#pragma region InlineStorage
+
+	// A buffer of Blocks blocks together with the arena that manages it. Meant to
+	// be a base class placed before the container that allocates from it, so that
+	// the arena is constructed first and destroyed last.
+	template <size_t BlockSize, size_t Alignment, size_t Blocks>
+	class InlineStorage
+	{
+
+	protected:
+
+		alignas(Alignment) std::byte _buffer[BlockSize * Blocks];
+		InlineArena _arena;
+
+		InlineStorage();
+		InlineStorage(const InlineStorage&) = delete;
+		InlineStorage& operator=(const InlineStorage&) = delete;
+	};
+
+#pragma endregion
+
+}// namespace detail
+
+// Allocator serving single objects from an InlineArena while it has room, and
+// everything else from the global heap. Copies and rebinds share the arena and
+// compare equal; allocators of different arenas compare unequal and never
+// propagate, so containers move elements rather than nodes between them.
+// A default-constructed InlineAllocator has no arena and always uses the heap.
+template <typename T>
+class InlineAllocator
+{
+
+private:
+
+	detail::InlineArena* _arena;
+
+	template <typename U>
+	friend class InlineAllocator;
+
+public:
+
+	using value_type = T;
+	using propagate_on_container_copy_assignment = std::false_type;
+	using propagate_on_container_move_assignment = std::false_type;
+	using propagate_on_container_swap = std::false_type;
+	using is_always_equal = std::false_type;
+
+	InlineAllocator() noexcept;
+	explicit InlineAllocator(detail::InlineArena* arena) noexcept;
+	template <typename U>
+	InlineAllocator(const InlineAllocator<U>& other) noexcept;
+
+	T* allocate(size_t n);
+	void deallocate(T* ptr, size_t n);
+
+	// A copied container must not allocate from the arena of its source.
+	InlineAllocator select_on_container_copy_construction() const;
+
+	template <typename U>
+	bool operator==(const InlineAllocator<U>& other) const noexcept;
+};
+
+#pragma region InlineArena
+
+inline detail::InlineArena::InlineArena(std::byte* buffer, size_t blockSize, size_t alignment, size_t blocks)
+	: _begin(buffer), _end(buffer + blockSize * blocks), _unused(buffer), _blockSize(blockSize), _alignment(alignment), _free(nullptr) { }
+
+inline void* detail::InlineArena::allocate(size_t size, size_t alignment)
+{
+	if (size > _blockSize || alignment > _alignment)
+		return nullptr;
+
+	if (_free != nullptr)
+	{
+		FreeBlock* block = _free;
+		_free = block->_next;
+		return block;
+	}
+
+	if (_unused == _end)
+		return nullptr;
+
+	void* block = _unused;
+	_unused += _blockSize;
+	return block;
+}
+
+inline void detail::InlineArena::deallocate(void* block)
+{
+	_free = ::new (block) FreeBlock{ _free };
+}
+
+inline bool detail::InlineArena::owns(const void* ptr) const
+{
+	const std::byte* address = static_cast<const std::byte*>(ptr);
+	return address >= _begin && address < _end;
+}
+
+inline size_t detail::InlineArena::free_blocks() const
+{
+	size_t count = static_cast<size_t>(_end - _unused) / _blockSize;
+	for (FreeBlock* block = _free; block != nullptr; block = block->_next)
+		++count;
+
+	return count;
+}
+
+#pragma endregion
+
+#pragma region InlineStorage
+
+template<size_t BlockSize, size_t Alignment, size_t Blocks>
+detail::InlineStorage<BlockSize, Alignment, Blocks>::InlineStorage() : _arena(_buffer, BlockSize, Alignment, Blocks)
+{
+	static_assert(BlockSize % Alignment == 0, "Blocks must stay aligned back to back");
+	static_assert(BlockSize >= sizeof(void*) && Alignment >= alignof(void*), "A free block must hold a pointer");
+}
+
+#pragma endregion
+
+#pragma region InlineAllocator
+
+template<typename T>
+InlineAllocator<T>::InlineAllocator() noexcept : _arena(nullptr) { }
+
+template<typename T>
+InlineAllocator<T>::InlineAllocator(detail::InlineArena* arena) noexcept : _arena(arena) { }
+
+template<typename T>
+template<typename U>
+InlineAllocator<T>::InlineAllocator(const InlineAllocator<U>& other) noexcept : _arena(other._arena) { }
+
+template<typename T>
+T* InlineAllocator<T>::allocate(size_t n)
+{
+	if (n == 1 && _arena != nullptr)
+	{
+		if (void* block = _arena->allocate(sizeof(T), alignof(T)))
+			return static_cast<T*>(block);
+	}
+
+	return std::allocator<T>().allocate(n);
+}
+
+template<typename T>
+void InlineAllocator<T>::deallocate(T* ptr, size_t n)
+{
+	if (_arena != nullptr && _arena->owns(ptr))
+		_arena->deallocate(ptr);
+	else
+		std::allocator<T>().deallocate(ptr, n);
+}
+
+template<typename T>
+InlineAllocator<T> InlineAllocator<T>::select_on_container_copy_construction() const
+{
+	return InlineAllocator();
+}
+
+template<typename T>
+template<typename U>
+bool InlineAllocator<T>::operator==(const InlineAllocator<U>& other) const noexcept
+{
+	return _arena == other._arena;
+}
+
+#pragma endregion
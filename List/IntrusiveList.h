@@ -0,0 +1,705 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+// Links embedded in an object so that IntrusiveList can chain the object itself
+// instead of copying it into a node. An object may embed several hooks and be on
+// one list per hook at the same time.
+//
+// With AutoUnlink, destroying a linked object removes it from its list. Such
+// lists cannot keep a size counter, so their size() walks the list.
+template <bool AutoUnlink = false>
+class BasicListHook
+{
+
+private:
+
+	BasicListHook* _next;
+	BasicListHook* _prev;
+
+	void link_before(BasicListHook* pos) noexcept;
+	void unlink_hook() noexcept;
+
+	template <typename T, auto Hook>
+	friend class IntrusiveList;
+
+public:
+
+	BasicListHook() noexcept;
+	~BasicListHook();
+
+	// Copying the owning object does not copy its list membership.
+	BasicListHook(const BasicListHook& other) noexcept;
+	BasicListHook& operator=(const BasicListHook& other) noexcept;
+
+	bool is_linked() const noexcept;
+
+	// Only auto-unlink hooks can leave their list on their own; a plain hook is
+	// removed through its list so that the list's size stays correct.
+	void unlink() noexcept requires AutoUnlink;
+};
+
+using ListHook = BasicListHook<false>;
+using AutoUnlinkListHook = BasicListHook<true>;
+
+// Doubly linked list of objects that are owned elsewhere. Hook is a pointer to
+// the BasicListHook member used for this list, e.g. IntrusiveList<Task, &Task::lruHook>.
+// Linking and unlinking never allocate; clear() and the destructor unlink the
+// objects without destroying them. An object must not be linked through the same
+// hook twice, and must outlive its membership unless its hook auto-unlinks.
+template <typename T, auto Hook>
+class IntrusiveList
+{
+
+private:
+
+	using HookType = std::remove_reference_t<decltype(std::declval<T&>().*Hook)>;
+	static constexpr bool auto_unlink = std::is_same_v<HookType, AutoUnlinkListHook>;
+
+	static_assert(std::is_same_v<HookType, ListHook> || auto_unlink, "Hook must point to a ListHook or AutoUnlinkListHook member of T");
+	static_assert(std::is_standard_layout_v<T>, "IntrusiveList finds an object from its hook by offset, so T must be standard-layout");
+
+	static std::ptrdiff_t hook_offset();
+	static HookType* hook_of(T& val);
+	static T* owner_of(HookType* hook);
+	static const T* owner_of(const HookType* hook);
+
+	HookType _sentinel;
+	size_t _size;
+
+public:
+
+#pragma region Iterator
+
+	class iterator
+	{
+	public:
+		using value_type = T;
+		using difference_type = std::ptrdiff_t;
+		using pointer = T*;
+		using reference = T&;
+		using iterator_category = std::bidirectional_iterator_tag;
+
+	private:
+		HookType* _hook;
+
+	public:
+		iterator(HookType* hook = nullptr);
+
+		reference operator*() const;
+		pointer operator->() const;
+		iterator& operator++();
+		iterator operator++(int);
+		iterator& operator--();
+		iterator operator--(int);
+		bool operator==(const iterator& other) const;
+		bool operator!=(const iterator& other) const;
+
+		friend class const_iterator;
+		friend class IntrusiveList;
+	};
+
+	static_assert(std::bidirectional_iterator<iterator>);
+
+#pragma endregion
+
+#pragma region Const Iterator
+
+	class const_iterator
+	{
+	public:
+		using value_type = T;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const T*;
+		using reference = const T&;
+		using iterator_category = std::bidirectional_iterator_tag;
+
+	private:
+		const HookType* _hook;
+
+	public:
+		const_iterator(const HookType* hook = nullptr);
+		const_iterator(const iterator& iter);
+
+		reference operator*() const;
+		pointer operator->() const;
+		const_iterator& operator++();
+		const_iterator operator++(int);
+		const_iterator& operator--();
+		const_iterator operator--(int);
+		bool operator==(const const_iterator& other) const;
+		bool operator!=(const const_iterator& other) const;
+
+		friend class IntrusiveList;
+	};
+
+	static_assert(std::bidirectional_iterator<const_iterator>);
+
+#pragma endregion
+
+	using reverse_iterator = std::reverse_iterator<iterator>;
+	using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+	IntrusiveList() noexcept;
+	IntrusiveList(const IntrusiveList& other) = delete;
+	IntrusiveList(IntrusiveList&& other) noexcept;
+	~IntrusiveList();
+
+	bool empty() const noexcept;
+	size_t size() const noexcept;
+	T& front();
+	const T& front() const;
+	T& back();
+	const T& back() const;
+	void clear() noexcept;
+
+	void push_front(T& val) noexcept;
+	void push_back(T& val) noexcept;
+	void pop_front() noexcept;
+	void pop_back() noexcept;
+	iterator insert(const const_iterator& pos, T& val) noexcept;
+	iterator erase(const const_iterator& pos) noexcept;
+	void erase(T& val) noexcept;
+	void splice(const const_iterator& pos, IntrusiveList& other) noexcept;
+	void swap(IntrusiveList& other) noexcept;
+
+	iterator iterator_to(T& val) noexcept;
+	const_iterator iterator_to(const T& val) const noexcept;
+
+	iterator begin();
+	iterator end();
+	const_iterator begin() const;
+	const_iterator end() const;
+	const_iterator cbegin() const;
+	const_iterator cend() const;
+	reverse_iterator rbegin();
+	reverse_iterator rend();
+	const_reverse_iterator rbegin() const;
+	const_reverse_iterator rend() const;
+	const_reverse_iterator crbegin() const;
+	const_reverse_iterator crend() const;
+
+	IntrusiveList& operator=(const IntrusiveList& other) = delete;
+	IntrusiveList& operator=(IntrusiveList&& other) noexcept;
+
+};
+
+#pragma region ListHook
+
+template<bool AutoUnlink>
+BasicListHook<AutoUnlink>::BasicListHook() noexcept : _next(nullptr), _prev(nullptr) { }
+
+template<bool AutoUnlink>
+BasicListHook<AutoUnlink>::BasicListHook(const BasicListHook&) noexcept : BasicListHook() { }
+
+template<bool AutoUnlink>
+BasicListHook<AutoUnlink>& BasicListHook<AutoUnlink>::operator=(const BasicListHook&) noexcept
+{
+	return *this;
+}
+
+template<bool AutoUnlink>
+BasicListHook<AutoUnlink>::~BasicListHook()
+{
+	if constexpr (AutoUnlink)
+	{
+		if (is_linked())
+			unlink_hook();
+	}
+}
+
+template<bool AutoUnlink>
+bool BasicListHook<AutoUnlink>::is_linked() const noexcept
+{
+	return _next != nullptr;
+}
+
+template<bool AutoUnlink>
+void BasicListHook<AutoUnlink>::unlink() noexcept requires AutoUnlink
+{
+	if (is_linked())
+		unlink_hook();
+}
+
+template<bool AutoUnlink>
+void BasicListHook<AutoUnlink>::link_before(BasicListHook* pos) noexcept
+{
+	_next = pos;
+	_prev = pos->_prev;
+	_prev->_next = this;
+	pos->_prev = this;
+}
+
+template<bool AutoUnlink>
+void BasicListHook<AutoUnlink>::unlink_hook() noexcept
+{
+	_prev->_next = _next;
+	_next->_prev = _prev;
+	_next = _prev = nullptr;
+}
+
+#pragma endregion
+
+#pragma region CtorsAndDestructors
+
+template<typename T, auto Hook>
+IntrusiveList<T, Hook>::IntrusiveList() noexcept : _size(0)
+{
+	_sentinel._next = _sentinel._prev = &_sentinel;
+}
+
+template<typename T, auto Hook>
+IntrusiveList<T, Hook>::IntrusiveList(IntrusiveList&& other) noexcept : IntrusiveList()
+{
+	swap(other);
+}
+
+template<typename T, auto Hook>
+IntrusiveList<T, Hook>::~IntrusiveList()
+{
+	clear();
+}
+
+template<typename T, auto Hook>
+IntrusiveList<T, Hook>::iterator::iterator(HookType* hook) : _hook(hook) { }
+
+template<typename T, auto Hook>
+IntrusiveList<T, Hook>::const_iterator::const_iterator(const HookType* hook) : _hook(hook) { }
+
+template<typename T, auto Hook>
+IntrusiveList<T, Hook>::const_iterator::const_iterator(const iterator& iter) : _hook(iter._hook) { }
+
+#pragma endregion
+
+#pragma region Hook
+
+template<typename T, auto Hook>
+IntrusiveList<T, Hook>::HookType* IntrusiveList<T, Hook>::hook_of(T& val)
+{
+	return &(val.*Hook);
+}
+
+// offsetof(T, hook) for the member Hook points to. The Itanium C++ ABI and MSVC
+// both represent a pointer to a data member of a standard-layout class as the
+// member's byte offset (64-bit on Itanium, 32-bit on MSVC), so the offset is read
+// from Hook itself and no T object is needed.
+template<typename T, auto Hook>
+std::ptrdiff_t IntrusiveList<T, Hook>::hook_offset()
+{
+	using Member = decltype(Hook);
+	static_assert(sizeof(Member) == sizeof(std::int32_t) || sizeof(Member) == sizeof(std::int64_t), "Unsupported pointer-to-member representation");
+
+	if constexpr (sizeof(Member) == sizeof(std::int32_t))
+		return std::bit_cast<std::int32_t>(Hook);
+	else
+		return static_cast<std::ptrdiff_t>(std::bit_cast<std::int64_t>(Hook));
+}
+
+// Recovers the owning object from its hook by subtracting the offset of the hook
+// member.
+template<typename T, auto Hook>
+T* IntrusiveList<T, Hook>::owner_of(HookType* hook)
+{
+	return reinterpret_cast<T*>(reinterpret_cast<unsigned char*>(hook) - hook_offset());
+}
+
+template<typename T, auto Hook>
+const T* IntrusiveList<T, Hook>::owner_of(const HookType* hook)
+{
+	return owner_of(const_cast<HookType*>(hook));
+}
+
+#pragma endregion
+
+#pragma region GetElement
+
+template<typename T, auto Hook>
+bool IntrusiveList<T, Hook>::empty() const noexcept
+{
+	return _sentinel._next == &_sentinel;
+}
+
+// O(1), except for auto-unlink hooks, whose objects can leave without the list
+// noticing.
+template<typename T, auto Hook>
+size_t IntrusiveList<T, Hook>::size() const noexcept
+{
+	if constexpr (auto_unlink)
+	{
+		size_t count = 0;
+		for (const HookType* curr = _sentinel._next; curr != &_sentinel; curr = curr->_next)
+			++count;
+
+		return count;
+	}
+	else
+		return _size;
+}
+
+template<typename T, auto Hook>
+T& IntrusiveList<T, Hook>::front()
+{
+	return *owner_of(static_cast<HookType*>(_sentinel._next));
+}
+
+template<typename T, auto Hook>
+const T& IntrusiveList<T, Hook>::front() const
+{
+	return *owner_of(static_cast<const HookType*>(_sentinel._next));
+}
+
+template<typename T, auto Hook>
+T& IntrusiveList<T, Hook>::back()
+{
+	return *owner_of(static_cast<HookType*>(_sentinel._prev));
+}
+
+template<typename T, auto Hook>
+const T& IntrusiveList<T, Hook>::back() const
+{
+	return *owner_of(static_cast<const HookType*>(_sentinel._prev));
+}
+
+#pragma endregion
+
+#pragma region Xary
+
+template<typename T, auto Hook>
+void IntrusiveList<T, Hook>::clear() noexcept
+{
+	HookType* curr = static_cast<HookType*>(_sentinel._next);
+	while (curr != &_sentinel)
+	{
+		HookType* next = static_cast<HookType*>(curr->_next);
+		curr->_next = curr->_prev = nullptr;
+		curr = next;
+	}
+
+	_sentinel._next = _sentinel._prev = &_sentinel;
+	_size = 0;
+}
+
+template<typename T, auto Hook>
+void IntrusiveList<T, Hook>::push_front(T& val) noexcept
+{
+	insert(begin(), val);
+}
+
+template<typename T, auto Hook>
+void IntrusiveList<T, Hook>::push_back(T& val) noexcept
+{
+	insert(end(), val);
+}
+
+template<typename T, auto Hook>
+void IntrusiveList<T, Hook>::pop_front() noexcept
+{
+	if (!empty())
+		erase(begin());
+}
+
+template<typename T, auto Hook>
+void IntrusiveList<T, Hook>::pop_back() noexcept
+{
+	if (!empty())
+		erase(--end());
+}
+
+template<typename T, auto Hook>
+IntrusiveList<T, Hook>::iterator IntrusiveList<T, Hook>::insert(const const_iterator& pos, T& val) noexcept
+{
+	HookType* hook = hook_of(val);
+	hook->link_before(const_cast<HookType*>(pos._hook));
+	++_size;
+
+	return iterator(hook);
+}
+
+template<typename T, auto Hook>
+IntrusiveList<T, Hook>::iterator IntrusiveList<T, Hook>::erase(const const_iterator& pos) noexcept
+{
+	HookType* hook = const_cast<HookType*>(pos._hook);
+	HookType* next = static_cast<HookType*>(hook->_next);
+
+	hook->unlink_hook();
+	--_size;
+
+	return iterator(next);
+}
+
+// val must be linked into this list through Hook.
+template<typename T, auto Hook>
+void IntrusiveList<T, Hook>::erase(T& val) noexcept
+{
+	erase(iterator_to(val));
+}
+
+template<typename T, auto Hook>
+void IntrusiveList<T, Hook>::splice(const const_iterator& pos, IntrusiveList& other) noexcept
+{
+	if (this == &other || other.empty())
+		return;
+
+	HookType* at = const_cast<HookType*>(pos._hook);
+	HookType* first = static_cast<HookType*>(other._sentinel._next);
+	HookType* last = static_cast<HookType*>(other._sentinel._prev);
+
+	other._sentinel._next = other._sentinel._prev = &other._sentinel;
+
+	first->_prev = at->_prev;
+	at->_prev->_next = first;
+	last->_next = at;
+	at->_prev = last;
+
+	_size += other._size;
+	other._size = 0;
+}
+
+template<typename T, auto Hook>
+void IntrusiveList<T, Hook>::swap(IntrusiveList& other) noexcept
+{
+	std::swap(_sentinel._next, other._sentinel._next);
+	std::swap(_sentinel._prev, other._sentinel._prev);
+	std::swap(_size, other._size);
+
+	for (IntrusiveList* lst : { this, &other })
+	{
+		HookType* sentinel = &lst->_sentinel;
+		if (sentinel->_next == &other._sentinel || sentinel->_next == &_sentinel)
+			sentinel->_next = sentinel->_prev = sentinel;
+		else
+			sentinel->_next->_prev = sentinel->_prev->_next = sentinel;
+	}
+}
+
+template<typename T, auto Hook>
+IntrusiveList<T, Hook>::iterator IntrusiveList<T, Hook>::iterator_to(T& val) noexcept
+{
+	return iterator(hook_of(val));
+}
+
+template<typename T, auto Hook>
+IntrusiveList<T, Hook>::const_iterator IntrusiveList<T, Hook>::iterator_to(const T& val) const noexcept
+{
+	return const_iterator(&(val.*Hook));
+}
+
+#pragma endregion
+
+#pragma region Operators
+
+template<typename T, auto Hook>
+void swap(IntrusiveList<T, Hook>& lhs, IntrusiveList<T, Hook>& rhs) noexcept
+{
+	lhs.swap(rhs);
+}
+
+template<typename T, auto Hook>
+IntrusiveList<T, Hook>& IntrusiveList<T, Hook>::operator=(IntrusiveList&& other) noexcept
+{
+	if (this == &other) return *this;
+
+	clear();
+	swap(other);
+
+	return *this;
+}
+
+#pragma endregion
+
+#pragma region Iterator
+
+template<typename T, auto Hook>
+IntrusiveList<T, Hook>::iterator IntrusiveList<T, Hook>::begin()
+{
+	return iterator(static_cast<HookType*>(_sentinel._next));
+}
+
+template<typename T, auto Hook>
+IntrusiveList<T, Hook>::iterator IntrusiveList<T, Hook>::end()
+{
+	return iterator(&_sentinel);
+}
+
+template<typename T, auto Hook>
+IntrusiveList<T, Hook>::iterator::reference IntrusiveList<T, Hook>::iterator::operator*() const
+{
+	return *owner_of(_hook);
+}
+
+template<typename T, auto Hook>
+IntrusiveList<T, Hook>::iterator::pointer IntrusiveList<T, Hook>::iterator::operator->() const
+{
+	return owner_of(_hook);
+}
+
+template<typename T, auto Hook>
+IntrusiveList<T, Hook>::iterator& IntrusiveList<T, Hook>::iterator::operator++()
+{
+	_hook = static_cast<HookType*>(_hook->_next);
+	return *this;
+}
+
+template<typename T, auto Hook>
+IntrusiveList<T, Hook>::iterator IntrusiveList<T, Hook>::iterator::operator++(int)
+{
+	iterator result(*this);
+	++(*this);
+	return result;
+}
+
+template<typename T, auto Hook>
+IntrusiveList<T, Hook>::iterator& IntrusiveList<T, Hook>::iterator::operator--()
+{
+	_hook = static_cast<HookType*>(_hook->_prev);
+	return *this;
+}
+
+template<typename T, auto Hook>
+IntrusiveList<T, Hook>::iterator IntrusiveList<T, Hook>::iterator::operator--(int)
+{
+	iterator result(*this);
+	--(*this);
+	return result;
+}
+
+template<typename T, auto Hook>
+bool IntrusiveList<T, Hook>::iterator::operator==(const iterator& other) const
+{
+	return _hook == other._hook;
+}
+
+template<typename T, auto Hook>
+bool IntrusiveList<T, Hook>::iterator::operator!=(const iterator& other) const
+{
+	return !(*this == other);
+}
+
+#pragma endregion
+
+#pragma region Const Iterator
+
+template<typename T, auto Hook>
+IntrusiveList<T, Hook>::const_iterator IntrusiveList<T, Hook>::begin() const
+{
+	return const_iterator(static_cast<const HookType*>(_sentinel._next));
+}
+
+template<typename T, auto Hook>
+IntrusiveList<T, Hook>::const_iterator IntrusiveList<T, Hook>::end() const
+{
+	return const_iterator(&_sentinel);
+}
+
+template<typename T, auto Hook>
+IntrusiveList<T, Hook>::const_iterator IntrusiveList<T, Hook>::cbegin() const
+{
+	return begin();
+}
+
+template<typename T, auto Hook>
+IntrusiveList<T, Hook>::const_iterator IntrusiveList<T, Hook>::cend() const
+{
+	return end();
+}
+
+template<typename T, auto Hook>
+IntrusiveList<T, Hook>::const_iterator::reference IntrusiveList<T, Hook>::const_iterator::operator*() const
+{
+	return *owner_of(_hook);
+}
+
+template<typename T, auto Hook>
+IntrusiveList<T, Hook>::const_iterator::pointer IntrusiveList<T, Hook>::const_iterator::operator->() const
+{
+	return owner_of(_hook);
+}
+
+template<typename T, auto Hook>
+IntrusiveList<T, Hook>::const_iterator& IntrusiveList<T, Hook>::const_iterator::operator++()
+{
+	_hook = static_cast<const HookType*>(_hook->_next);
+	return *this;
+}
+
+template<typename T, auto Hook>
+IntrusiveList<T, Hook>::const_iterator IntrusiveList<T, Hook>::const_iterator::operator++(int)
+{
+	const_iterator result(*this);
+	++(*this);
+	return result;
+}
+
+template<typename T, auto Hook>
+IntrusiveList<T, Hook>::const_iterator& IntrusiveList<T, Hook>::const_iterator::operator--()
+{
+	_hook = static_cast<const HookType*>(_hook->_prev);
+	return *this;
+}
+
+template<typename T, auto Hook>
+IntrusiveList<T, Hook>::const_iterator IntrusiveList<T, Hook>::const_iterator::operator--(int)
+{
+	const_iterator result(*this);
+	--(*this);
+	return result;
+}
+
+template<typename T, auto Hook>
+bool IntrusiveList<T, Hook>::const_iterator::operator==(const const_iterator& other) const
+{
+	return _hook == other._hook;
+}
+
+template<typename T, auto Hook>
+bool IntrusiveList<T, Hook>::const_iterator::operator!=(const const_iterator& other) const
+{
+	return !(*this == other);
+}
+
+#pragma endregion
+
+#pragma region Reverse Iterator
+
+template<typename T, auto Hook>
+IntrusiveList<T, Hook>::reverse_iterator IntrusiveList<T, Hook>::rbegin()
+{
+	return reverse_iterator(end());
+}
+
+template<typename T, auto Hook>
+IntrusiveList<T, Hook>::reverse_iterator IntrusiveList<T, Hook>::rend()
+{
+	return reverse_iterator(begin());
+}
+
+template<typename T, auto Hook>
+IntrusiveList<T, Hook>::const_reverse_iterator IntrusiveList<T, Hook>::rbegin() const
+{
+	return const_reverse_iterator(end());
+}
+
+template<typename T, auto Hook>
+IntrusiveList<T, Hook>::const_reverse_iterator IntrusiveList<T, Hook>::rend() const
+{
+	return const_reverse_iterator(begin());
+}
+
+template<typename T, auto Hook>
+IntrusiveList<T, Hook>::const_reverse_iterator IntrusiveList<T, Hook>::crbegin() const
+{
+	return rbegin();
+}
+
+template<typename T, auto Hook>
+IntrusiveList<T, Hook>::const_reverse_iterator IntrusiveList<T, Hook>::crend() const
+{
+	return rend();
+}
+
+#pragma endregion
@@ -1,30 +1,133 @@
 #pragma once
 
+#include "ChainSort.h"
+#include "Parallel.h"
+#include "Prefetch.h"
+
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <iterator>
 #include <initializer_list>
-
-template <typename T>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+// Operations a List reports to an allocator that keeps statistics (see
+// StatsAllocator.h), each with the number of elements or comparisons involved.
+enum class ListEvent { push, pop, insert, erase, sort, comparison };
+
+template <typename T, typename Alloc = std::allocator<T>>
 class List
 {
 
+public:
+
+	using allocator_type = Alloc;
+
 private:
 
 #pragma region Node
 
-	struct Node
+	// The sentinel only needs the links, so it is a plain NodeBase and never
+	// constructs a T. Element nodes store the value inline, right after the links.
+	struct NodeBase
 	{
-		T* _val;
-		Node* _next;
-		Node* _prev;
+		NodeBase* _next;
+		NodeBase* _prev;
+
+		NodeBase(NodeBase* next = nullptr, NodeBase* prev = nullptr);
+	};
 
-		Node(T* val = nullptr, Node* next = nullptr, Node* prev = nullptr);
-		Node(const T& val, Node* next = nullptr, Node* prev = nullptr);
+	// The value is a union member so that it is constructed through the allocator
+	// (uses-allocator construction for pmr types) after the node memory exists.
+	struct Node : NodeBase
+	{
+		union
+		{
+			T _val;
+		};
+
+		Node(NodeBase* next = nullptr, NodeBase* prev = nullptr);
 		~Node();
 	};
 
-	Node* _head;
-	Node* _tail;
+	using AllocTraits = std::allocator_traits<Alloc>;
+	using NodeAlloc = typename AllocTraits::template rebind_alloc<Node>;
+	using NodeTraits = std::allocator_traits<NodeAlloc>;
+
+	static T& value(NodeBase* node);
+	static const T& value(const NodeBase* node);
+
+	template <typename... Args>
+	Node* create_node(NodeBase* next, NodeBase* prev, Args&&... args);
+	template <typename... Args>
+	Node* construct_node(Node* node, NodeBase* next, NodeBase* prev, Args&&... args);
+	template <typename... Args>
+	Node* link_node(NodeBase* next, Args&&... args);
+	void destroy_node(NodeBase* node);
+	void swap_nodes(List& other) noexcept;
+
+	// A detached, null-terminated run of nodes that is built completely before
+	// it is linked into the list, so a throwing constructor leaves the list as it was.
+	struct Chain
+	{
+		NodeBase* _first = nullptr;
+		NodeBase* _last = nullptr;
+		size_t _size = 0;
+	};
+
+	template <typename InputIt, typename Sent>
+	Chain make_chain(InputIt first, Sent last);
+	template <typename... Args>
+	Chain make_chain_n(size_t count, const Args&... args);
+	template <typename... Args>
+	void chain_append(Chain& chain, Args&&... args);
+	void destroy_chain(NodeBase* first);
+	size_t erase_nodes(NodeBase* first, NodeBase* last);
+	template <typename Match>
+	size_t remove_nodes(Match& match, const T* deferred = nullptr);
+	NodeBase* link_chain(NodeBase* pos, const Chain& chain);
+	void reserve_chain(size_t count);
+
+	template <typename Compare>
+	static NodeBase* merge_chains(NodeBase* first, NodeBase* second, Compare& comp);
+	template <typename Compare>
+	static NodeBase* sort_chain(NodeBase* first, Compare& comp);
+	template <typename Compare>
+	static auto by_value(Compare& comp);
+	void relink_sorted(NodeBase* sorted);
+	template <typename Compare>
+	void sort_runs(size_t threads, Compare& comp);
+	template <typename Compare>
+	void merge_runs(List& other, Compare& comp);
+
+	// Only allocators with a record() member hear about operations; for all others
+	// the calls compile to nothing and comparators are not wrapped.
+	static constexpr bool records_events = requires(NodeAlloc& alloc) { alloc.record(ListEvent::push, size_t(1)); };
+	void record(ListEvent event, size_t count = 1);
+	template <typename Compare, typename Counter>
+	static auto counting(const Compare& comp, Counter& count);
+
+	// Fewest elements per worker for which the parallel algorithms use a thread.
+	static constexpr size_t parallel_grain = 1 << 14;
+	std::vector<NodeBase*> split_nodes(size_t parts) const;
+	template <typename Visit>
+	NodeBase* walk_prefetch(size_t distance, Visit& visit) const;
+	static void transfer(NodeBase* pos, NodeBase* first, NodeBase* last);
+	bool shares_nodes(const List& other) const;
+	void move_nodes(NodeBase* pos, List& other, NodeBase* first, NodeBase* last);
+
+	// A single circular sentinel lives inside the list object: its _next is the
+	// first element and its _prev the last, and an empty list links it to itself.
+	// Iterators to end() are therefore tied to the list object, not to its nodes.
+	[[no_unique_address]] NodeAlloc _alloc;
+	NodeBase _sentinel;
 	size_t _size;
 
 #pragma endregion
@@ -36,7 +139,7 @@ public:
 	class iterator
 	{
 	private:
-		Node* _current;
+		NodeBase* _current;
 
 	public:
 		using value_type = T;
@@ -45,7 +148,7 @@ public:
 		using reference = T&;
 		using iterator_category = std::bidirectional_iterator_tag;
 
-		iterator(Node* ptr = nullptr);
+		iterator(NodeBase* ptr = nullptr);
 
 		iterator& operator=(const iterator& source);
 		reference operator*() const;
@@ -69,6 +172,7 @@ public:
 
 	class reverse_iterator
 	{
+	public:
 		using value_type = T;
 		using difference_type = std::ptrdiff_t;
 		using pointer = T*;
@@ -76,10 +180,10 @@ public:
 		using iterator_category = std::bidirectional_iterator_tag;
 
 	private:
-		Node* _current;
+		NodeBase* _current;
 
 	public:
-		reverse_iterator(Node* ptr);
+		reverse_iterator(NodeBase* ptr);
 
 		reverse_iterator& operator=(const reverse_iterator& source);
 		reference operator*() const;
@@ -100,6 +204,7 @@ public:
 
 	class const_iterator
 	{
+	public:
 		using value_type = T;
 		using difference_type = std::ptrdiff_t;
 		using pointer = const T*;
@@ -107,10 +212,10 @@ public:
 		using iterator_category = std::bidirectional_iterator_tag;
 
 	private:
-		const Node* _current;
+		const NodeBase* _current;
 
 	public:
-		const_iterator(const Node* ptr);
+		const_iterator(const NodeBase* ptr);
 		const_iterator(const iterator& iter);
 
 		const_iterator& operator=(const const_iterator& source);
@@ -132,6 +237,7 @@ public:
 
 	class const_reverse_iterator
 	{
+	public:
 		using value_type = T;
 		using difference_type = std::ptrdiff_t;
 		using pointer = const T*;
@@ -139,10 +245,10 @@ public:
 		using iterator_category = std::bidirectional_iterator_tag;
 
 	private:
-		const Node* _current;
+		const NodeBase* _current;
 
 	public:
-		const_reverse_iterator(const Node* ptr);
+		const_reverse_iterator(const NodeBase* ptr);
 
 		const_reverse_iterator& operator=(const const_reverse_iterator& source);
 		reference  operator*() const;
@@ -159,31 +265,116 @@ public:
 
 #pragma endregion
 
-	List();
-	List(size_t size);
-	List(size_t size, const T& val);
+	// Size and alignment of the memory that holds one element, for allocators that
+	// hand out fixed-size blocks.
+	static constexpr size_t node_size = sizeof(Node);
+	static constexpr size_t node_alignment = alignof(Node);
+
+	List() noexcept(noexcept(Alloc()));
+	explicit List(const Alloc& alloc) noexcept;
+	List(size_t size, const Alloc& alloc = Alloc());
+	List(size_t size, const T& val, const Alloc& alloc = Alloc());
 	List(const List& other);
-	List(std::initializer_list<T> initList);
+	List(const List& other, const Alloc& alloc);
+	List(List&& other) noexcept;
+	List(std::initializer_list<T> initList, const Alloc& alloc = Alloc());
 	template <std::input_iterator iter>
-	List(iter begin, iter end);
+	List(iter begin, iter end, const Alloc& alloc = Alloc());
 	~List();
 
-	bool empty();
+	allocator_type get_allocator() const;
+
+	bool empty() const noexcept;
 	T& front();
 	const T& front() const;
 	T& back();
 	const T& back() const;
-	size_t size();
+	size_t size() const noexcept;
 	void clear();
+	void reserve_nodes(size_t count);
+	void shrink_to_fit();
+	void defragment();
+	iterator defragment(const const_iterator& first, size_t count);
+	double locality() const;
 
 	void push_front(const T& val);
+	void push_front(T&& val);
 	void push_back(const T& val);
+	void push_back(T&& val);
+	template <typename... Args>
+	T& emplace_front(Args&&... args);
+	template <typename... Args>
+	T& emplace_back(Args&&... args);
+	template <typename... Args>
+	iterator emplace(const const_iterator& pos, Args&&... args);
 	void pop_front();
 	void pop_back();
 	void insert(const iterator& iter, const T& val);
-	void erase(const iterator& iter);
+	void insert(const iterator& iter, T&& val);
+	iterator insert(const const_iterator& pos, size_t count, const T& val);
+	template <std::input_iterator iter>
+	iterator insert(const const_iterator& pos, iter first, iter last);
+	iterator insert(const const_iterator& pos, std::initializer_list<T> initList);
+	template <std::ranges::input_range R>
+	iterator insert_range(const const_iterator& pos, R&& range);
+	template <std::ranges::input_range R>
+	void append_range(R&& range);
+	template <std::ranges::input_range R>
+	void prepend_range(R&& range);
+	void assign(size_t count, const T& val);
+	template <std::input_iterator iter>
+	void assign(iter first, iter last);
+	void assign(std::initializer_list<T> initList);
+	template <std::ranges::input_range R>
+	void assign_range(R&& range);
+	iterator erase(const const_iterator& pos);
+	iterator erase(const const_iterator& first, const const_iterator& last);
+	size_t remove(const T& val);
+	template <typename Predicate>
+	size_t remove_if(Predicate pred);
+	size_t unique();
+	template <typename BinaryPredicate>
+	size_t unique(BinaryPredicate pred);
+	void splice(const const_iterator& pos, List& other);
+	void splice(const const_iterator& pos, List&& other);
+	void splice(const const_iterator& pos, List& other, const const_iterator& iter);
+	void splice(const const_iterator& pos, List&& other, const const_iterator& iter);
+	void splice(const const_iterator& pos, List& other, const const_iterator& first, const const_iterator& last);
+	void splice(const const_iterator& pos, List&& other, const const_iterator& first, const const_iterator& last);
 	void merge(List& other);
+	void merge(List&& other);
+	template <typename Compare>
+	void merge(List& other, Compare comp);
+	template <typename Compare>
+	void merge(List&& other, Compare comp);
 	void sort();
+	template <typename Compare>
+	void sort(Compare comp);
+	void parallel_sort(size_t threads = 0);
+	template <typename Compare>
+	void parallel_sort(size_t threads, Compare comp);
+	template <typename Func>
+	void parallel_for_each(Func func, size_t threads = 0);
+	template <typename Result, typename Reduce, typename Transform>
+	Result parallel_transform_reduce(Result init, Reduce reduce, Transform transform, size_t threads = 0) const;
+	template <typename Predicate>
+	size_t parallel_count_if(Predicate pred, size_t threads = 0) const;
+
+	// How many nodes ahead of the visited element the *_prefetch traversals load.
+	static constexpr size_t prefetch_distance = 8;
+	template <typename Func>
+	void for_each_prefetch(Func func, size_t distance = prefetch_distance);
+	template <typename Func>
+	void for_each_prefetch(Func func, size_t distance = prefetch_distance) const;
+	template <typename U>
+	iterator find_prefetch(const U& val, size_t distance = prefetch_distance);
+	template <typename U>
+	const_iterator find_prefetch(const U& val, size_t distance = prefetch_distance) const;
+	template <typename Predicate>
+	size_t count_if_prefetch(Predicate pred, size_t distance = prefetch_distance) const;
+	template <typename Result, typename BinaryOp = std::plus<>>
+	Result accumulate_prefetch(Result init, BinaryOp op = BinaryOp(), size_t distance = prefetch_distance) const;
+	void swap(List& other);
 
 	iterator begin();
 	iterator end();
@@ -199,369 +390,1501 @@ public:
 	const_reverse_iterator crend() const;
 
 	List& operator=(const List& other);
+	List& operator=(List&& other) noexcept(AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value);
 
-	template <typename U>
-	friend bool operator==(const List<U>& lhs, const List<U>& rhs);
+private:
+
+	static NodeBase* node_of(const const_iterator& iter);
+
+public:
+
+	template <typename U, typename A>
+	friend bool operator==(const List<U, A>& lhs, const List<U, A>& rhs);
 
 };
 
 #pragma region CtorsAndDestructors
 
-template<typename T>
-List<T>::List() : _head(new Node()), _tail(new Node()), _size(0)
+template<typename T, typename Alloc>
+List<T, Alloc>::List() noexcept(noexcept(Alloc())) : List(Alloc()) { }
+
+template<typename T, typename Alloc>
+List<T, Alloc>::List(const Alloc& alloc) noexcept : _alloc(alloc), _sentinel(&_sentinel, &_sentinel), _size(0) { }
+
+template<typename T, typename Alloc>
+List<T, Alloc>::List(size_t size, const Alloc& alloc) : List(alloc)
 {
-	_head->_next = _tail;
-	_tail->_prev = _head;
+	link_chain(&_sentinel, make_chain_n(size));
 }
 
-template<typename T>
-List<T>::List(size_t size) : _head(new Node()), _tail(new Node()), _size(size)
+template<typename T, typename Alloc>
+List<T, Alloc>::List(size_t size, const T& val, const Alloc& alloc) : List(alloc)
 {
-	Node* temp = _head;
-	for (size_t i = 0; i < size; i++)
+	link_chain(&_sentinel, make_chain_n(size, val));
+}
+
+template<typename T, typename Alloc>
+List<T, Alloc>::List(const List& other) : List(other, AllocTraits::select_on_container_copy_construction(other.get_allocator())) { }
+
+template<typename T, typename Alloc>
+List<T, Alloc>::List(const List& other, const Alloc& alloc) : List(alloc)
+{
+	reserve_chain(other._size);
+	link_chain(&_sentinel, make_chain(other.begin(), other.end()));
+}
+
+template<typename T, typename Alloc>
+List<T, Alloc>::List(List&& other) noexcept : List(other._alloc)
+{
+	swap_nodes(other);
+}
+
+template<typename T, typename Alloc>
+List<T, Alloc>::List(std::initializer_list<T> initList, const Alloc& alloc) : List(alloc)
+{
+	link_chain(&_sentinel, make_chain(initList.begin(), initList.end()));
+}
+
+template<typename T, typename Alloc>
+template<std::input_iterator iter>
+List<T, Alloc>::List(iter begin, iter end, const Alloc& alloc) : List(alloc)
+{
+	link_chain(&_sentinel, make_chain(begin, end));
+}
+
+template<typename T, typename Alloc>
+List<T, Alloc>::~List()
+{
+	clear();
+}
+
+template<typename T, typename Alloc>
+List<T, Alloc>::allocator_type List<T, Alloc>::get_allocator() const
+{
+	return allocator_type(_alloc);
+}
+
+template<typename T, typename Alloc>
+List<T, Alloc>::NodeBase::NodeBase(NodeBase* next, NodeBase* prev) : _next(next), _prev(prev) { }
+
+template<typename T, typename Alloc>
+List<T, Alloc>::Node::Node(NodeBase* next, NodeBase* prev) : NodeBase(next, prev) { }
+
+template<typename T, typename Alloc>
+List<T, Alloc>::Node::~Node() { }
+
+template<typename T, typename Alloc>
+template<typename... Args>
+List<T, Alloc>::Node* List<T, Alloc>::create_node(NodeBase* next, NodeBase* prev, Args&&... args)
+{
+	Node* node = NodeTraits::allocate(_alloc, 1);
+
+	try
 	{
-		temp->_next = new Node(T(), nullptr, temp);
-		temp = temp->_next;
+		return construct_node(node, next, prev, std::forward<Args>(args)...);
+	}
+	catch (...)
+	{
+		NodeTraits::deallocate(_alloc, node, 1);
+		throw;
 	}
-
-	temp->_next = _tail;
-	_tail->_prev = temp;
 }
 
-template<typename T>
-List<T>::List(size_t size, const T& val) : _head(new Node()), _tail(new Node()), _size(size)
+// Builds a node in memory obtained from _alloc. If the value cannot be
+// constructed, the memory is left unconstructed and still needs deallocating.
+template<typename T, typename Alloc>
+template<typename... Args>
+List<T, Alloc>::Node* List<T, Alloc>::construct_node(Node* node, NodeBase* next, NodeBase* prev, Args&&... args)
 {
+	::new (static_cast<void*>(node)) Node(next, prev);
 
-	Node* temp = _head;
-	for (size_t i = 0; i < size; i++)
+	try
+	{
+		NodeTraits::construct(_alloc, std::addressof(node->_val), std::forward<Args>(args)...);
+	}
+	catch (...)
 	{
-		temp->_next = new Node(val, nullptr, temp);
-		temp = temp->_next;
+		node->~Node();
+		throw;
 	}
 
-	temp->_next = _tail;
-	_tail->_prev = temp;
+	return node;
 }
 
-template<typename T>
-List<T>::List(const List& other) : _head(new Node()), _tail(new Node()), _size(other._size)
+template<typename T, typename Alloc>
+void List<T, Alloc>::destroy_node(NodeBase* node)
 {
-	_head->_next = _tail;
-	_tail->_prev = _head;
+	Node* p = static_cast<Node*>(node);
+	NodeTraits::destroy(_alloc, std::addressof(p->_val));
+	p->~Node();
+	NodeTraits::deallocate(_alloc, p, 1);
+}
+
+// Creates a node and links it in front of next.
+template<typename T, typename Alloc>
+template<typename... Args>
+List<T, Alloc>::Node* List<T, Alloc>::link_node(NodeBase* next, Args&&... args)
+{
+	Node* newNode = create_node(next, next->_prev, std::forward<Args>(args)...);
+
+	next->_prev->_next = newNode;
+	next->_prev = newNode;
 
-	Node* curr = other._head->_next;
-	while (curr != other._tail)
+	++_size;
+	return newNode;
+}
+
+// Exchanges the node chains of two lists. The first and last nodes point back at
+// the sentinel of the list that owns them, so those two links are re-aimed.
+template<typename T, typename Alloc>
+void List<T, Alloc>::swap_nodes(List& other) noexcept
+{
+	std::swap(_sentinel._next, other._sentinel._next);
+	std::swap(_sentinel._prev, other._sentinel._prev);
+	std::swap(_size, other._size);
+
+	for (List* lst : { this, &other })
 	{
-		push_back(*(curr->_val));
-		curr = curr->_next;
+		if (lst->_size == 0)
+			lst->_sentinel._next = lst->_sentinel._prev = &lst->_sentinel;
+		else
+			lst->_sentinel._next->_prev = lst->_sentinel._prev->_next = &lst->_sentinel;
 	}
 }
 
-template<typename T>
-List<T>::List(std::initializer_list<T> initList) : _head(new Node()), _tail(new Node()), _size(initList.size())
+template<typename T, typename Alloc>
+template<typename InputIt, typename Sent>
+List<T, Alloc>::Chain List<T, Alloc>::make_chain(InputIt first, Sent last)
 {
-	Node* temp = _head;
-	for (auto iter = initList.begin(); iter != initList.end(); ++iter)
+	if constexpr (std::sized_sentinel_for<Sent, InputIt>)
+		reserve_chain(static_cast<size_t>(last - first));
+
+	Chain chain;
+	try
 	{
-		temp->_next = new Node(*iter, nullptr, temp);
-		temp = temp->_next;
+		for (; first != last; ++first)
+			chain_append(chain, *first);
+	}
+	catch (...)
+	{
+		destroy_chain(chain._first);
+		throw;
 	}
 
-	temp->_next = _tail;
-	_tail->_prev = temp;
+	return chain;
 }
 
-template<typename T>
-template<std::input_iterator iter>
-List<T>::List(iter begin, iter end) : _head(new Node()), _tail(new Node())
+template<typename T, typename Alloc>
+template<typename... Args>
+List<T, Alloc>::Chain List<T, Alloc>::make_chain_n(size_t count, const Args&... args)
 {
-	Node* temp = _head;
-	for (auto iter = begin; iter != end; ++iter)
+	reserve_chain(count);
+
+	Chain chain;
+	try
 	{
-		temp->_next = new Node(*iter, nullptr, temp);
-		temp = temp->_next;
+		for (size_t i = 0; i < count; ++i)
+			chain_append(chain, args...);
+	}
+	catch (...)
+	{
+		destroy_chain(chain._first);
+		throw;
+	}
+
+	return chain;
+}
+
+template<typename T, typename Alloc>
+template<typename... Args>
+void List<T, Alloc>::chain_append(Chain& chain, Args&&... args)
+{
+	Node* newNode = create_node(nullptr, chain._last, std::forward<Args>(args)...);
+
+	if (chain._last != nullptr)
+		chain._last->_next = newNode;
+	else
+		chain._first = newNode;
+
+	chain._last = newNode;
+	++chain._size;
+}
 
-		++_size;
+template<typename T, typename Alloc>
+void List<T, Alloc>::destroy_chain(NodeBase* first)
+{
+	while (first != nullptr)
+	{
+		NodeBase* next = first->_next;
+		destroy_node(first);
+		first = next;
 	}
+}
+
+// Unlinks and destroys the nodes [first, last) and returns how many there were.
+template<typename T, typename Alloc>
+size_t List<T, Alloc>::erase_nodes(NodeBase* first, NodeBase* last)
+{
+	if (first == last)
+		return 0;
+
+	first->_prev->_next = last;
+	last->_prev->_next = nullptr;
+	last->_prev = first->_prev;
 
-	temp->_next = _tail;
-	_tail->_prev = temp;
+	size_t count = 0;
+	for (NodeBase* curr = first; curr != nullptr; curr = curr->_next)
+		++count;
+
+	_size -= count;
+	destroy_chain(first);
+	return count;
 }
 
-template<typename T>
-List<T>::~List()
+// Unlinks every element node for which match(node) holds in a single pass and
+// destroys it on the spot, while it is still in cache: deferring the frees to a
+// batch at the end costs a second walk over the removed nodes, which on lists
+// larger than the cache is slower than the frees themselves. A node's _prev is
+// always the last node kept before it. The node holding *deferred, if it is
+// removed, is destroyed only after the pass, so match may compare against it.
+// If match throws, the nodes not yet reached stay in the list.
+template<typename T, typename Alloc>
+template<typename Match>
+size_t List<T, Alloc>::remove_nodes(Match& match, const T* deferred)
 {
-	Node* p = _head;
-	while (p != nullptr)
+	NodeBase* last = nullptr;
+	size_t count = 0;
+
+	auto finish = [&]
 	{
-		Node* p_next = p->_next;
-		delete p;
-		p = p_next;
+		if (last != nullptr)
+			destroy_node(last);
+		record(ListEvent::erase, count);
+	};
+
+	try
+	{
+		NodeBase* curr = _sentinel._next;
+		while (curr != &_sentinel)
+		{
+			NodeBase* next = curr->_next;
+			if (match(curr))
+			{
+				curr->_prev->_next = next;
+				next->_prev = curr->_prev;
+				--_size;
+				++count;
+
+				if (std::addressof(value(curr)) == deferred)
+					last = curr;
+				else
+					destroy_node(curr);
+			}
+			curr = next;
+		}
+	}
+	catch (...)
+	{
+		finish();
+		throw;
 	}
 
-	_size = 0;
+	finish();
+	return count;
+}
+
+template<typename T, typename Alloc>
+List<T, Alloc>::NodeBase* List<T, Alloc>::link_chain(NodeBase* pos, const Chain& chain)
+{
+	if (chain._first == nullptr)
+		return pos;
+
+	chain._first->_prev = pos->_prev;
+	chain._last->_next = pos;
+	pos->_prev->_next = chain._first;
+	pos->_prev = chain._last;
+
+	_size += chain._size;
+	return chain._first;
 }
 
-template<typename T>
-List<T>::Node::~Node()
+// Lets a pool-backed allocator set aside storage for a whole chain in one go.
+template<typename T, typename Alloc>
+void List<T, Alloc>::reserve_chain(size_t count)
 {
-	delete _val;
+	if constexpr (requires(NodeAlloc& alloc) { alloc.reserve(count); })
+		_alloc.reserve(count);
 }
 
-template<typename T>
-List<T>::Node::Node(T* val, Node* next, Node* prev) : _val(val), _next(next), _prev(prev) { }
+template<typename T, typename Alloc>
+T& List<T, Alloc>::value(NodeBase* node)
+{
+	return static_cast<Node*>(node)->_val;
+}
 
-template<typename T>
-List<T>::Node::Node(const T& val, Node* next, Node* prev) : _val(new T(val)), _next(next), _prev(prev) { }
+template<typename T, typename Alloc>
+const T& List<T, Alloc>::value(const NodeBase* node)
+{
+	return static_cast<const Node*>(node)->_val;
+}
 
-template<typename T>
-List<T>::iterator::iterator(Node* ptr) : _current(ptr) { }
+template<typename T, typename Alloc>
+List<T, Alloc>::iterator::iterator(NodeBase* ptr) : _current(ptr) { }
 
-template<typename T>
-List<T>::reverse_iterator::reverse_iterator(Node* ptr) : _current(ptr) { }
+template<typename T, typename Alloc>
+List<T, Alloc>::reverse_iterator::reverse_iterator(NodeBase* ptr) : _current(ptr) { }
 
-template<typename T>
-List<T>::const_iterator::const_iterator(const Node* ptr) : _current(ptr) { }
+template<typename T, typename Alloc>
+List<T, Alloc>::const_iterator::const_iterator(const NodeBase* ptr) : _current(ptr) { }
 
-template<typename T>
-List<T>::const_iterator::const_iterator(const iterator& iter) : _current(iter._current) { }
+template<typename T, typename Alloc>
+List<T, Alloc>::const_iterator::const_iterator(const iterator& iter) : _current(iter._current) { }
 
-template<typename T>
-List<T>::const_reverse_iterator::const_reverse_iterator(const Node* ptr) : _current(ptr) { }
+template<typename T, typename Alloc>
+List<T, Alloc>::const_reverse_iterator::const_reverse_iterator(const NodeBase* ptr) : _current(ptr) { }
 
 #pragma endregion
 
 #pragma region GetElement
 
-template<typename T>
-bool List<T>::empty()
+template<typename T, typename Alloc>
+bool List<T, Alloc>::empty() const noexcept
 {
 	return _size == 0;
 }
 
-template<typename T>
-T& List<T>::front()
+template<typename T, typename Alloc>
+T& List<T, Alloc>::front()
 {
-	return *(_head->_next->_val);
+	return value(_sentinel._next);
 }
 
-template<typename T>
-const T& List<T>::front() const
+template<typename T, typename Alloc>
+const T& List<T, Alloc>::front() const
 {
-	return *(_head->_next->_val);
+	return value(_sentinel._next);
 }
 
-template<typename T>
-T& List<T>::back()
+template<typename T, typename Alloc>
+T& List<T, Alloc>::back()
 {
-	return *(_tail->_prev->_val);
+	return value(_sentinel._prev);
 }
 
-template<typename T>
-const T& List<T>::back() const
+template<typename T, typename Alloc>
+const T& List<T, Alloc>::back() const
 {
-	return *(_tail->_prev->_val);
+	return value(_sentinel._prev);
 }
 
 #pragma endregion
 
 #pragma region Xary
 
-template<typename T>
-size_t List<T>::size()
+template<typename T, typename Alloc>
+size_t List<T, Alloc>::size() const noexcept
 {
 	return _size;
 }
 
-template<typename T>
-void List<T>::push_front(const T& val)
+template<typename T, typename Alloc>
+void List<T, Alloc>::push_front(const T& val)
+{
+	emplace_front(val);
+}
+
+template<typename T, typename Alloc>
+void List<T, Alloc>::push_front(T&& val)
 {
-	_head->_next = new Node(val, _head->_next, _head);
-	_head->_next->_next->_prev = _head->_next;
+	emplace_front(std::move(val));
+}
 
-	++_size;
+template<typename T, typename Alloc>
+void List<T, Alloc>::push_back(const T& val)
+{
+	emplace_back(val);
 }
 
-template<typename T>
-void List<T>::push_back(const T& val)
+template<typename T, typename Alloc>
+void List<T, Alloc>::push_back(T&& val)
 {
-	_tail->_prev = new Node(val, _tail, _tail->_prev);
-	_tail->_prev->_prev->_next = _tail->_prev;
+	emplace_back(std::move(val));
+}
 
-	++_size;
+// The value is constructed directly in the node from args, so T needs to be
+// neither copyable nor movable.
+template<typename T, typename Alloc>
+template<typename... Args>
+T& List<T, Alloc>::emplace_front(Args&&... args)
+{
+	Node* newNode = link_node(_sentinel._next, std::forward<Args>(args)...);
+	record(ListEvent::push);
+	return newNode->_val;
 }
 
-template<typename T>
-void List<T>::pop_front()
+template<typename T, typename Alloc>
+template<typename... Args>
+T& List<T, Alloc>::emplace_back(Args&&... args)
 {
-	if (_head->_next == _tail)
+	Node* newNode = link_node(&_sentinel, std::forward<Args>(args)...);
+	record(ListEvent::push);
+	return newNode->_val;
+}
+
+template<typename T, typename Alloc>
+template<typename... Args>
+List<T, Alloc>::iterator List<T, Alloc>::emplace(const const_iterator& pos, Args&&... args)
+{
+	Node* newNode = link_node(node_of(pos), std::forward<Args>(args)...);
+	record(ListEvent::insert);
+	return iterator(newNode);
+}
+
+template<typename T, typename Alloc>
+void List<T, Alloc>::pop_front()
+{
+	if (_sentinel._next == &_sentinel)
 		return;
 
-	Node* temp = _head->_next;
-	_head->_next = temp->_next;
-	_head->_next->_prev = _head;
+	NodeBase* temp = _sentinel._next;
+	_sentinel._next = temp->_next;
+	_sentinel._next->_prev = &_sentinel;
 
-	delete temp;
+	destroy_node(temp);
 	--_size;
+	record(ListEvent::pop);
 }
 
-template<typename T>
-void List<T>::pop_back()
+template<typename T, typename Alloc>
+void List<T, Alloc>::pop_back()
 {
-	if (_head->_next == _tail)
+	if (_sentinel._next == &_sentinel)
 		return;
 
-	Node* temp = _tail->_prev;
-	_tail->_prev = temp->_prev;
-	_tail->_prev->_next = _tail;
+	NodeBase* temp = _sentinel._prev;
+	_sentinel._prev = temp->_prev;
+	_sentinel._prev->_next = &_sentinel;
 
-	delete temp;
+	destroy_node(temp);
 	--_size;
+	record(ListEvent::pop);
 }
 
-template<typename T>
-void List<T>::clear()
+template<typename T, typename Alloc>
+void List<T, Alloc>::clear()
 {
-	Node* p = _head->_next;
-	while (p != _tail)
+	NodeBase* p = _sentinel._next;
+	while (p != &_sentinel)
 	{
-		Node* p_next = p->_next;
-		delete p;
+		NodeBase* p_next = p->_next;
+		destroy_node(p);
 		p = p_next;
 	}
 
-	_head->_next = _tail;
-	_tail->_prev = _head;
+	_sentinel._next = &_sentinel;
+	_sentinel._prev = &_sentinel;
 
 	_size = 0;
 }
 
-template<typename T>
-void List<T>::insert(const List<T>::iterator& iter, const T& val)
+// Pool-backed allocators (see PoolAllocator.h) can set node storage aside up front
+// and give unused slabs back; for any other allocator these two calls do nothing.
+template<typename T, typename Alloc>
+void List<T, Alloc>::reserve_nodes(size_t count)
+{
+	if (count > _size)
+		reserve_chain(count - _size);
+}
+
+template<typename T, typename Alloc>
+void List<T, Alloc>::shrink_to_fit()
+{
+	if constexpr (requires(NodeAlloc& alloc) { alloc.shrink_to_fit(); })
+		_alloc.shrink_to_fit();
+}
+
+// Moves every element into a new node so that walking the list visits memory in
+// ascending address order. All new nodes of a batch are allocated first and then
+// filled in address order, whatever order the allocator returned them in: memory
+// fresh from the heap or a PoolAllocator slab ends up back to back, and blocks
+// recycled from scattered free lists are at least visited front to back. The old
+// nodes are freed only afterwards, so they cannot be handed straight back.
+// Needs a temporary table of one pointer per relocated node.
+//
+// Invalidates every iterator, pointer and reference to the elements; end() stays
+// valid. Elements are moved if their move constructor is noexcept and copied
+// otherwise; if that or an allocation throws, the list is left as it was.
+template<typename T, typename Alloc>
+void List<T, Alloc>::defragment()
 {
+	defragment(begin(), _size);
+}
 
-	Node* newNode = new Node(val, iter._current, iter._current->_prev);
+// Incremental form: relocates at most count nodes starting at first and returns
+// the first node not relocated, from which the next call can continue. Only
+// iterators to the relocated elements are invalidated.
+template<typename T, typename Alloc>
+List<T, Alloc>::iterator List<T, Alloc>::defragment(const const_iterator& first, size_t count)
+{
+	NodeBase* begin = node_of(first);
+	NodeBase* end = begin;
 
-	iter._current->_prev->_next = newNode;
-	iter._current->_prev = newNode;
+	size_t relocated = 0;
+	for (; end != &_sentinel && relocated < count; end = end->_next)
+		++relocated;
 
-	++_size;
+	if (relocated == 0)
+		return iterator(end);
+
+	reserve_chain(relocated);
+
+	std::vector<Node*> fresh;
+	fresh.reserve(relocated);
+	try
+	{
+		while (fresh.size() < relocated)
+			fresh.push_back(NodeTraits::allocate(_alloc, 1));
+	}
+	catch (...)
+	{
+		for (Node* node : fresh)
+			NodeTraits::deallocate(_alloc, node, 1);
+		throw;
+	}
+
+	std::sort(fresh.begin(), fresh.end(), std::less<Node*>());
+
+	Chain chain;
+	size_t built = 0;
+	try
+	{
+		for (NodeBase* curr = begin; curr != end; curr = curr->_next, ++built)
+		{
+			Node* node = construct_node(fresh[built], nullptr, chain._last, std::move_if_noexcept(value(curr)));
+			if (chain._last != nullptr)
+				chain._last->_next = node;
+			else
+				chain._first = node;
+
+			chain._last = node;
+			++chain._size;
+		}
+	}
+	catch (...)
+	{
+		destroy_chain(chain._first);
+		for (size_t i = built; i < relocated; ++i)
+			NodeTraits::deallocate(_alloc, fresh[i], 1);
+		throw;
+	}
+
+	erase_nodes(begin, end);
+	link_chain(end, chain);
+
+	return iterator(end);
 }
 
-template<typename T>
-void List<T>::erase(const iterator& iter)
+// Share of neighbouring elements whose nodes are also neighbours in memory, the
+// next one starting after the previous and at most a cache line past its end:
+// 1 for a list laid out in order, close to 0 for one scattered by churn. Lists
+// with fewer than two elements count as laid out in order. Takes a full walk.
+template<typename T, typename Alloc>
+double List<T, Alloc>::locality() const
 {
-	//iteratori het petqa mi ban anel, jamanak chkar nayei std-um vonca implementac :)
+	if (_size < 2)
+		return 1.0;
+
+	size_t close = 0;
+	for (const NodeBase* curr = _sentinel._next; curr->_next != &_sentinel; curr = curr->_next)
+	{
+		uintptr_t here = reinterpret_cast<uintptr_t>(curr);
+		uintptr_t next = reinterpret_cast<uintptr_t>(curr->_next);
+		if (next > here && next - here <= sizeof(Node) + detail::cache_line)
+			++close;
+	}
 
-	iter._current->_prev->_next = iter._current->_next;
-	iter._current->_next->_prev = iter._current->_prev;
+	return static_cast<double>(close) / static_cast<double>(_size - 1);
+}
+
+template<typename T, typename Alloc>
+void List<T, Alloc>::insert(const List<T, Alloc>::iterator& iter, const T& val)
+{
+	emplace(iter, val);
+}
+
+template<typename T, typename Alloc>
+void List<T, Alloc>::insert(const List<T, Alloc>::iterator& iter, T&& val)
+{
+	emplace(iter, std::move(val));
+}
+
+// The bulk insertions and assign() build their nodes off to the side and link
+// them in with one relink; if constructing an element throws, the list is unchanged.
+template<typename T, typename Alloc>
+List<T, Alloc>::iterator List<T, Alloc>::insert(const const_iterator& pos, size_t count, const T& val)
+{
+	Chain chain = make_chain_n(count, val);
+	record(ListEvent::insert, chain._size);
+	return iterator(link_chain(node_of(pos), chain));
+}
+
+template<typename T, typename Alloc>
+template<std::input_iterator iter>
+List<T, Alloc>::iterator List<T, Alloc>::insert(const const_iterator& pos, iter first, iter last)
+{
+	Chain chain = make_chain(first, last);
+	record(ListEvent::insert, chain._size);
+	return iterator(link_chain(node_of(pos), chain));
+}
+
+template<typename T, typename Alloc>
+List<T, Alloc>::iterator List<T, Alloc>::insert(const const_iterator& pos, std::initializer_list<T> initList)
+{
+	return insert(pos, initList.begin(), initList.end());
+}
 
-	delete iter._current;
+template<typename T, typename Alloc>
+template<std::ranges::input_range R>
+List<T, Alloc>::iterator List<T, Alloc>::insert_range(const const_iterator& pos, R&& range)
+{
+	if constexpr (std::ranges::sized_range<R>)
+		reserve_chain(static_cast<size_t>(std::ranges::size(range)));
+
+	Chain chain = make_chain(std::ranges::begin(range), std::ranges::end(range));
+	record(ListEvent::insert, chain._size);
+	return iterator(link_chain(node_of(pos), chain));
+}
+
+template<typename T, typename Alloc>
+template<std::ranges::input_range R>
+void List<T, Alloc>::append_range(R&& range)
+{
+	insert_range(end(), std::forward<R>(range));
+}
+
+template<typename T, typename Alloc>
+template<std::ranges::input_range R>
+void List<T, Alloc>::prepend_range(R&& range)
+{
+	insert_range(begin(), std::forward<R>(range));
+}
+
+template<typename T, typename Alloc>
+void List<T, Alloc>::assign(size_t count, const T& val)
+{
+	Chain chain = make_chain_n(count, val);
+	clear();
+	link_chain(&_sentinel, chain);
+}
+
+template<typename T, typename Alloc>
+template<std::input_iterator iter>
+void List<T, Alloc>::assign(iter first, iter last)
+{
+	Chain chain = make_chain(first, last);
+	clear();
+	link_chain(&_sentinel, chain);
+}
+
+template<typename T, typename Alloc>
+void List<T, Alloc>::assign(std::initializer_list<T> initList)
+{
+	assign(initList.begin(), initList.end());
+}
+
+template<typename T, typename Alloc>
+template<std::ranges::input_range R>
+void List<T, Alloc>::assign_range(R&& range)
+{
+	if constexpr (std::ranges::sized_range<R>)
+		reserve_chain(static_cast<size_t>(std::ranges::size(range)));
+
+	Chain chain = make_chain(std::ranges::begin(range), std::ranges::end(range));
+	clear();
+	link_chain(&_sentinel, chain);
+}
+
+template<typename T, typename Alloc>
+List<T, Alloc>::iterator List<T, Alloc>::erase(const const_iterator& pos)
+{
+	NodeBase* node = node_of(pos);
+	NodeBase* next = node->_next;
+
+	node->_prev->_next = next;
+	next->_prev = node->_prev;
+
+	destroy_node(node);
 	--_size;
+	record(ListEvent::erase);
+
+	return iterator(next);
+}
+
+// Returns last, the element that followed the erased range.
+template<typename T, typename Alloc>
+List<T, Alloc>::iterator List<T, Alloc>::erase(const const_iterator& first, const const_iterator& last)
+{
+	record(ListEvent::erase, erase_nodes(node_of(first), node_of(last)));
+	return iterator(node_of(last));
 }
 
-template<typename T>
-void List<T>::merge(List& other)
+// remove, remove_if and unique return the number of elements removed, found and
+// freed in a single pass (see remove_nodes).
+template<typename T, typename Alloc>
+size_t List<T, Alloc>::remove(const T& val)
 {
-	if (this == &other) return;
+	auto match = [&val](NodeBase* node) { return value(node) == val; };
+	return remove_nodes(match, std::addressof(val));
+}
 
-	auto thisIter = begin();
-	auto otherIter = other.begin();
+template<typename T, typename Alloc>
+template<typename Predicate>
+size_t List<T, Alloc>::remove_if(Predicate pred)
+{
+	auto match = [&pred](NodeBase* node) { return static_cast<bool>(pred(value(node))); };
+	return remove_nodes(match);
+}
 
-	while (thisIter != end() && otherIter != other.end())
+template<typename T, typename Alloc>
+size_t List<T, Alloc>::unique()
+{
+	return unique(std::equal_to<>());
+}
+
+// Removes every element for which pred(kept, elem) holds, kept being the last
+// element before it that stays; with equality that leaves the first of each run.
+template<typename T, typename Alloc>
+template<typename BinaryPredicate>
+size_t List<T, Alloc>::unique(BinaryPredicate pred)
+{
+	auto match = [this, &pred](NodeBase* node)
 	{
-		if (*(otherIter) < *(thisIter))
+		return node->_prev != &_sentinel && static_cast<bool>(pred(value(node->_prev), value(node)));
+	};
+	return remove_nodes(match);
+}
+
+// The splice overloads move nodes from `other` (which may be this list for the
+// single-element and range forms) in front of pos by relinking them; iterators to
+// the moved elements stay valid and now refer into this list. When the allocators
+// differ, the nodes cannot change owner, so the elements are moved into new nodes
+// instead and iterators to them are invalidated.
+template<typename T, typename Alloc>
+void List<T, Alloc>::splice(const const_iterator& pos, List& other)
+{
+	if (this == &other || other._size == 0)
+		return;
+
+	if (!shares_nodes(other))
+	{
+		move_nodes(node_of(pos), other, other._sentinel._next, &other._sentinel);
+		return;
+	}
+
+	transfer(node_of(pos), other._sentinel._next, other._sentinel._prev);
+
+	_size += other._size;
+	other._size = 0;
+}
+
+template<typename T, typename Alloc>
+void List<T, Alloc>::splice(const const_iterator& pos, List&& other)
+{
+	splice(pos, other);
+}
+
+template<typename T, typename Alloc>
+void List<T, Alloc>::splice(const const_iterator& pos, List& other, const const_iterator& iter)
+{
+	NodeBase* node = node_of(iter);
+	NodeBase* posNode = node_of(pos);
+	if (posNode == node || posNode == node->_next)
+		return;
+
+	if (!shares_nodes(other))
+	{
+		move_nodes(posNode, other, node, node->_next);
+		return;
+	}
+
+	transfer(posNode, node, node);
+
+	++_size;
+	--other._size;
+}
+
+template<typename T, typename Alloc>
+void List<T, Alloc>::splice(const const_iterator& pos, List&& other, const const_iterator& iter)
+{
+	splice(pos, other, iter);
+}
+
+// Linear in the length of the range when it comes from another list, which is
+// needed to keep both sizes exact; constant otherwise.
+template<typename T, typename Alloc>
+void List<T, Alloc>::splice(const const_iterator& pos, List& other, const const_iterator& first, const const_iterator& last)
+{
+	if (first == last)
+		return;
+
+	if (!shares_nodes(other))
+	{
+		move_nodes(node_of(pos), other, node_of(first), node_of(last));
+		return;
+	}
+
+	if (this != &other)
+	{
+		size_t count = static_cast<size_t>(std::distance(first, last));
+		_size += count;
+		other._size -= count;
+	}
+
+	transfer(node_of(pos), node_of(first), node_of(last)->_prev);
+}
+
+template<typename T, typename Alloc>
+void List<T, Alloc>::splice(const const_iterator& pos, List&& other, const const_iterator& first, const const_iterator& last)
+{
+	splice(pos, other, first, last);
+}
+
+template<typename T, typename Alloc>
+void List<T, Alloc>::merge(List& other)
+{
+	merge(other, std::less<>());
+}
+
+template<typename T, typename Alloc>
+void List<T, Alloc>::merge(List&& other)
+{
+	merge(other, std::less<>());
+}
+
+// Both lists must already be sorted by `comp`. The nodes of `other` are relinked
+// into this list run by run, so nothing is allocated, copied or moved, unless the
+// allocators differ: then the elements are first moved into nodes of this list.
+// Stable: on ties the elements of this list come first.
+template<typename T, typename Alloc>
+template<typename Compare>
+void List<T, Alloc>::merge(List& other, Compare comp)
+{
+	if (this == &other || other._size == 0)
+		return;
+
+	if (!shares_nodes(other))
+	{
+		List moved(get_allocator());
+		moved.splice(moved.end(), other);
+		merge(moved, comp);
+		return;
+	}
+
+	if constexpr (records_events)
+	{
+		size_t comparisons = 0;
+		auto counted = counting(comp, comparisons);
+		merge_runs(other, counted);
+		record(ListEvent::comparison, comparisons);
+	}
+	else
+		merge_runs(other, comp);
+}
+
+// Relinks the nodes of other, which shares this list's allocator, into this list.
+template<typename T, typename Alloc>
+template<typename Compare>
+void List<T, Alloc>::merge_runs(List& other, Compare& comp)
+{
+	NodeBase* curr = _sentinel._next;
+	NodeBase* otherCurr = other._sentinel._next;
+
+	while (curr != &_sentinel && otherCurr != &other._sentinel)
+	{
+		if (comp(value(otherCurr), value(curr)))
 		{
-			insert(thisIter, *(otherIter));
-			++otherIter;
+			NodeBase* runEnd = otherCurr->_next;
+			while (runEnd != &other._sentinel && comp(value(runEnd), value(curr)))
+				runEnd = runEnd->_next;
+
+			transfer(curr, otherCurr, runEnd->_prev);
+			otherCurr = runEnd;
 		}
 		else
-			++thisIter;
+			curr = curr->_next;
 	}
 
-	while (otherIter != other.end())
+	if (otherCurr != &other._sentinel)
+		transfer(&_sentinel, otherCurr, other._sentinel._prev);
+
+	_size += other._size;
+	other._size = 0;
+}
+
+template<typename T, typename Alloc>
+template<typename Compare>
+void List<T, Alloc>::merge(List&& other, Compare comp)
+{
+	merge(other, comp);
+}
+
+template<typename T, typename Alloc>
+void List<T, Alloc>::sort()
+{
+	sort(std::less<>());
+}
+
+// Bottom-up merge sort over the node chain: only _next/_prev are rewritten, no
+// element is copied or moved.
+template<typename T, typename Alloc>
+template<typename Compare>
+void List<T, Alloc>::sort(Compare comp)
+{
+	if (_size < 2)
+		return;
+
+	_sentinel._prev->_next = nullptr;
+	if constexpr (records_events)
 	{
-		push_back(*otherIter);
-		++otherIter;
+		size_t comparisons = 0;
+		auto counted = counting(comp, comparisons);
+		relink_sorted(sort_chain(_sentinel._next, counted));
+		record(ListEvent::comparison, comparisons);
 	}
+	else
+		relink_sorted(sort_chain(_sentinel._next, comp));
+
+	record(ListEvent::sort);
+}
 
-	other.clear();
+// Splits the list into one run per worker, sorts the runs concurrently, then
+// merges neighbouring runs pairwise, level by level, each level in parallel.
+// Runs are merged in list order, so the result is stable and equal to sort().
+// Like sort(), this only relinks nodes and allocates nothing but the run table;
+// the workers are threads of detail::WorkerPool, started once and reused by
+// later calls. Each worker uses its own copy of comp.
+template<typename T, typename Alloc>
+template<typename Compare>
+void List<T, Alloc>::parallel_sort(size_t threads, Compare comp)
+{
+	if constexpr (records_events)
+	{
+		std::atomic<size_t> comparisons = 0;
+		auto counted = counting(comp, comparisons);
+		sort_runs(threads, counted);
+		record(ListEvent::comparison, comparisons);
+		record(ListEvent::sort);
+	}
+	else
+		sort_runs(threads, comp);
 }
 
-template<typename T>
-void List<T>::sort()
+template<typename T, typename Alloc>
+template<typename Compare>
+void List<T, Alloc>::sort_runs(size_t threads, Compare& comp)
 {
-	if (_size == 0 || _size == 1)
+	size_t workers = detail::worker_count(threads, _size, parallel_grain);
+	if (workers < 2)
+	{
+		if (_size >= 2)
+		{
+			_sentinel._prev->_next = nullptr;
+			relink_sorted(sort_chain(_sentinel._next, comp));
+		}
 		return;
+	}
 
+	std::vector<NodeBase*> runs = split_nodes(workers);
+	for (size_t i = 1; i <= workers; ++i)
+		runs[i]->_prev->_next = nullptr;
 
-	size_t size = _size;
-	while (size--)
+	detail::fork_join(workers, [&](size_t i)
 	{
-		Node* curr = _head->_next;
-		bool isSwaped = false;
+		Compare localComp(comp);
+		runs[i] = sort_chain(runs[i], localComp);
+	});
 
-		while (curr->_next != _tail)
+	for (size_t width = 1; width < workers; width *= 2)
+	{
+		size_t pairs = (workers - width + 2 * width - 1) / (2 * width);
+		detail::fork_join(pairs, [&](size_t pair)
 		{
-			if ((*curr->_val) > (*(curr->_next)->_val))
-			{
-				T temp = *(curr->_val);
-				*(curr->_val) = *(curr->_next->_val);
-				*(curr->_next->_val) = temp;
+			Compare localComp(comp);
+			size_t i = pair * 2 * width;
+			runs[i] = merge_chains(runs[i], runs[i + width], localComp);
+		});
+	}
+
+	relink_sorted(runs[0]);
+}
+
+template<typename T, typename Alloc>
+void List<T, Alloc>::parallel_sort(size_t threads)
+{
+	parallel_sort(threads, std::less<>());
+}
+
+// Calls func on every element, the list split into contiguous segments of equal
+// length, one per worker; each worker uses its own copy of func. Lists too short
+// to give every worker parallel_grain elements use fewer workers, down to a plain
+// loop on the calling thread.
+template<typename T, typename Alloc>
+template<typename Func>
+void List<T, Alloc>::parallel_for_each(Func func, size_t threads)
+{
+	size_t workers = detail::worker_count(threads, _size, parallel_grain);
+	std::vector<NodeBase*> bounds = split_nodes(workers);
+
+	detail::fork_join(workers, [&](size_t i)
+	{
+		Func localFunc(func);
+		for (NodeBase* curr = bounds[i]; curr != bounds[i + 1]; curr = curr->_next)
+			localFunc(value(curr));
+	});
+}
+
+// Like std::transform_reduce: reduce must be associative, since each segment is
+// reduced on its own and the partial results are then folded into init in list
+// order. Commutativity is not needed.
+template<typename T, typename Alloc>
+template<typename Result, typename Reduce, typename Transform>
+Result List<T, Alloc>::parallel_transform_reduce(Result init, Reduce reduce, Transform transform, size_t threads) const
+{
+	size_t workers = detail::worker_count(threads, _size, parallel_grain);
+	if (_size == 0)
+		return init;
+
+	std::vector<NodeBase*> bounds = split_nodes(workers);
+	std::vector<std::optional<Result>> partials(workers);
+
+	detail::fork_join(workers, [&](size_t i)
+	{
+		Reduce localReduce(reduce);
+		Transform localTransform(transform);
+
+		NodeBase* curr = bounds[i];
+		Result partial = localTransform(std::as_const(value(curr)));
+		for (curr = curr->_next; curr != bounds[i + 1]; curr = curr->_next)
+			partial = localReduce(std::move(partial), localTransform(std::as_const(value(curr))));
+
+		partials[i].emplace(std::move(partial));
+	});
+
+	for (std::optional<Result>& partial : partials)
+		init = reduce(std::move(init), std::move(*partial));
 
-				isSwaped = true;
+	return init;
+}
+
+// The counting lambda is copied per worker like any transform, so each worker
+// calls its own copy of pred, which may have a non-const operator().
+template<typename T, typename Alloc>
+template<typename Predicate>
+size_t List<T, Alloc>::parallel_count_if(Predicate pred, size_t threads) const
+{
+	return parallel_transform_reduce(size_t(0), std::plus<>(),
+		[pred](const T& val) mutable { return pred(val) ? size_t(1) : size_t(0); }, threads);
+}
+
+// The prefetching traversals visit the elements in order, like a loop over
+// begin()..end(), while a second cursor runs `distance` nodes ahead and asks for
+// each node it reaches to be loaded into the cache. By the time a node is visited
+// its links and value are usually there, so the work done per element and a value
+// spanning several cache lines no longer add to every miss. The links themselves
+// are still followed one by one: this overlaps latency, it cannot remove it, and
+// on a list whose nodes are laid out in order it gains little. A distance of 0
+// traverses without prefetching.
+template<typename T, typename Alloc>
+template<typename Func>
+void List<T, Alloc>::for_each_prefetch(Func func, size_t distance)
+{
+	auto visit = [&func](NodeBase* node)
+	{
+		func(value(node));
+		return true;
+	};
+	walk_prefetch(distance, visit);
+}
+
+template<typename T, typename Alloc>
+template<typename Func>
+void List<T, Alloc>::for_each_prefetch(Func func, size_t distance) const
+{
+	auto visit = [&func](const NodeBase* node)
+	{
+		func(value(node));
+		return true;
+	};
+	walk_prefetch(distance, visit);
+}
+
+template<typename T, typename Alloc>
+template<typename U>
+List<T, Alloc>::iterator List<T, Alloc>::find_prefetch(const U& val, size_t distance)
+{
+	auto visit = [&val](const NodeBase* node) { return !(value(node) == val); };
+	return iterator(walk_prefetch(distance, visit));
+}
+
+template<typename T, typename Alloc>
+template<typename U>
+List<T, Alloc>::const_iterator List<T, Alloc>::find_prefetch(const U& val, size_t distance) const
+{
+	auto visit = [&val](const NodeBase* node) { return !(value(node) == val); };
+	return const_iterator(walk_prefetch(distance, visit));
+}
+
+template<typename T, typename Alloc>
+template<typename Predicate>
+size_t List<T, Alloc>::count_if_prefetch(Predicate pred, size_t distance) const
+{
+	size_t count = 0;
+	auto visit = [&pred, &count](const NodeBase* node)
+	{
+		if (pred(value(node)))
+			++count;
+		return true;
+	};
+	walk_prefetch(distance, visit);
+	return count;
+}
+
+template<typename T, typename Alloc>
+template<typename Result, typename BinaryOp>
+Result List<T, Alloc>::accumulate_prefetch(Result init, BinaryOp op, size_t distance) const
+{
+	auto visit = [&init, &op](const NodeBase* node)
+	{
+		init = op(std::move(init), value(node));
+		return true;
+	};
+	walk_prefetch(distance, visit);
+	return init;
+}
+
+// Calls visit on the element nodes in order until it returns false and returns
+// the node it stopped at, or the sentinel. `ahead` trails the visited node by
+// `distance` nodes and has its node prefetched as soon as its address is known.
+template<typename T, typename Alloc>
+template<typename Visit>
+List<T, Alloc>::NodeBase* List<T, Alloc>::walk_prefetch(size_t distance, Visit& visit) const
+{
+	NodeBase* sentinel = const_cast<NodeBase*>(&_sentinel);
+	NodeBase* ahead = sentinel->_next;
+
+	if (distance != 0)
+	{
+		for (size_t i = 0; i < distance && ahead != sentinel; ++i)
+		{
+			ahead = ahead->_next;
+			detail::prefetch(ahead, sizeof(Node));
+		}
+	}
+
+	for (NodeBase* curr = sentinel->_next; curr != sentinel; curr = curr->_next)
+	{
+		if (distance != 0 && ahead != sentinel)
+		{
+			ahead = ahead->_next;
+			detail::prefetch(ahead, sizeof(Node));
+		}
+
+		if (!visit(curr))
+			return curr;
+	}
+
+	return sentinel;
+}
+
+// Returns parts + 1 nodes cutting the list into parts segments whose lengths
+// differ by at most one: segment i is [bounds[i], bounds[i + 1]), the last bound
+// is the sentinel. A list holds no positional index, so the bounds are found by
+// walking; the front half is walked from the first node and the back half from
+// the last node, concurrently when the list is long enough to be worth a thread.
+template<typename T, typename Alloc>
+std::vector<typename List<T, Alloc>::NodeBase*> List<T, Alloc>::split_nodes(size_t parts) const
+{
+	std::vector<size_t> offsets(parts + 1, 0);
+	for (size_t i = 0; i < parts; ++i)
+		offsets[i + 1] = offsets[i] + _size / parts + (i < _size % parts ? 1 : 0);
+
+	NodeBase* sentinel = const_cast<NodeBase*>(&_sentinel);
+	std::vector<NodeBase*> bounds(parts + 1, sentinel);
+	size_t middle = static_cast<size_t>(std::upper_bound(offsets.begin(), offsets.end(), _size / 2) - offsets.begin());
+
+	auto walk = [&](size_t half)
+	{
+		if (half == 0)
+		{
+			NodeBase* curr = sentinel->_next;
+			size_t index = 0;
+			for (size_t i = 0; i < middle; ++i)
+			{
+				for (; index < offsets[i]; ++index)
+					curr = curr->_next;
+				bounds[i] = curr;
+			}
+		}
+		else
+		{
+			NodeBase* curr = sentinel;
+			size_t index = _size;
+			for (size_t i = parts + 1; i-- > middle;)
+			{
+				for (; index > offsets[i]; --index)
+					curr = curr->_prev;
+				bounds[i] = curr;
 			}
+		}
+	};
 
-			curr = curr->_next;
+	if (parts > 1 && _size >= 2 * parallel_grain)
+		detail::fork_join(2, walk);
+	else
+	{
+		walk(0);
+		walk(1);
+	}
+
+	return bounds;
+}
+
+// Sorts a null-terminated chain by relinking _next only and returns its new head.
+template<typename T, typename Alloc>
+template<typename Compare>
+List<T, Alloc>::NodeBase* List<T, Alloc>::sort_chain(NodeBase* first, Compare& comp)
+{
+	auto less = by_value(comp);
+	return detail::sort_chain(first, less);
+}
+
+// Makes a null-terminated chain holding all of the list's nodes the list's
+// contents again, restoring the _prev links and the sentinel.
+template<typename T, typename Alloc>
+void List<T, Alloc>::relink_sorted(NodeBase* sorted)
+{
+	NodeBase* prev = &_sentinel;
+	for (NodeBase* curr = sorted; curr != nullptr; curr = curr->_next)
+	{
+		prev->_next = curr;
+		curr->_prev = prev;
+		prev = curr;
+	}
+
+	prev->_next = &_sentinel;
+	_sentinel._prev = prev;
+}
+
+// Unlinks the nodes [first, last] from their list and links them in before pos.
+template<typename T, typename Alloc>
+void List<T, Alloc>::transfer(NodeBase* pos, NodeBase* first, NodeBase* last)
+{
+	first->_prev->_next = last->_next;
+	last->_next->_prev = first->_prev;
+
+	first->_prev = pos->_prev;
+	last->_next = pos;
+	pos->_prev->_next = first;
+	pos->_prev = last;
+}
+
+// Whether nodes allocated by other's allocator can be freed through this one.
+template<typename T, typename Alloc>
+bool List<T, Alloc>::shares_nodes(const List& other) const
+{
+	return AllocTraits::is_always_equal::value || _alloc == other._alloc;
+}
+
+// Moves the values of other's nodes [first, last) into new nodes in front of pos,
+// then erases them from other. If a move constructor throws, both lists keep
+// their nodes.
+template<typename T, typename Alloc>
+void List<T, Alloc>::move_nodes(NodeBase* pos, List& other, NodeBase* first, NodeBase* last)
+{
+	Chain chain;
+	try
+	{
+		for (NodeBase* curr = first; curr != last; curr = curr->_next)
+			chain_append(chain, std::move(value(curr)));
+	}
+	catch (...)
+	{
+		destroy_chain(chain._first);
+		throw;
+	}
+
+	link_chain(pos, chain);
+	other.erase_nodes(first, last);
+}
+
+template<typename T, typename Alloc>
+void List<T, Alloc>::record(ListEvent event, size_t count)
+{
+	if constexpr (records_events)
+		_alloc.record(event, count);
+}
+
+// Wraps a copy of comp so that every call also increments count. The parallel
+// sort hands copies of the wrapper to its workers, so there count is a std::atomic.
+template<typename T, typename Alloc>
+template<typename Compare, typename Counter>
+auto List<T, Alloc>::counting(const Compare& comp, Counter& count)
+{
+	return [comp, &count](const auto& lhs, const auto& rhs) mutable
+	{
+		++count;
+		return comp(lhs, rhs);
+	};
+}
+
+template<typename T, typename Alloc>
+List<T, Alloc>::NodeBase* List<T, Alloc>::node_of(const const_iterator& iter)
+{
+	return const_cast<NodeBase*>(iter._current);
+}
+
+// Merges two null-terminated singly linked chains; on ties the node from `first` wins.
+template<typename T, typename Alloc>
+template<typename Compare>
+List<T, Alloc>::NodeBase* List<T, Alloc>::merge_chains(NodeBase* first, NodeBase* second, Compare& comp)
+{
+	auto less = by_value(comp);
+	return detail::merge_chains(first, second, less);
+}
+
+// Adapts comp, which compares values, to the node comparison detail::sort_chain takes.
+template<typename T, typename Alloc>
+template<typename Compare>
+auto List<T, Alloc>::by_value(Compare& comp)
+{
+	return [&comp](const NodeBase* lhs, const NodeBase* rhs) { return comp(value(lhs), value(rhs)); };
+}
+
+template<typename T, typename Alloc>
+void List<T, Alloc>::swap(List& other)
+{
+	if constexpr (AllocTraits::propagate_on_container_swap::value)
+	{
+		using std::swap;
+		swap(_alloc, other._alloc);
+	}
+	else if (!shares_nodes(other))
+	{
+		// Each list keeps its allocator and its nodes: the common prefix swaps
+		// values, and the longer list's surplus is moved over by splice.
+		iterator curr = begin();
+		iterator otherCurr = other.begin();
+		for (; curr != end() && otherCurr != other.end(); ++curr, ++otherCurr)
+		{
+			using std::swap;
+			swap(*curr, *otherCurr);
 		}
 
-		if (isSwaped == false)
-			break;
+		if (curr != end())
+			other.splice(other.end(), *this, curr, end());
+		else
+			splice(end(), other, otherCurr, other.end());
+
+		return;
 	}
+
+	swap_nodes(other);
 }
 
 #pragma endregion
 
 #pragma region Operators
 
-template<typename T>
-bool operator==(const List<T>& lhs, const List<T>& rhs)
+template<typename T, typename Alloc>
+bool operator==(const List<T, Alloc>& lhs, const List<T, Alloc>& rhs)
 {
-	typename List<T>::Node* lhsP = lhs._head->_next;
-	typename List<T>::Node* rhsP = rhs._head->_next;
+	if (lhs._size != rhs._size)
+		return false;
+
+	auto lhsIter = lhs.begin();
+	auto rhsIter = rhs.begin();
 
-	while (lhsP != nullptr && rhsP != nullptr)
+	while (lhsIter != lhs.end())
 	{
-		if (lhsP->_val && rhsP->_val && *(lhsP->_val) != *(rhsP->_val))
+		if (*lhsIter != *rhsIter)
 			return false;
 
-		lhsP = lhsP->_next;
-		rhsP = rhsP->_next;
+		++lhsIter;
+		++rhsIter;
 	}
 
-	return lhsP == rhsP;
+	return true;
 }
 
-template<typename T>
-bool operator!=(const List<T>& lhs, const List<T>& rhs)
+template<typename T, typename Alloc>
+bool operator!=(const List<T, Alloc>& lhs, const List<T, Alloc>& rhs)
 {
 	return !(lhs == rhs);
 }
 
-template<typename T>
-List<T>& List<T>::operator=(const List& other)
+template<typename T, typename Alloc>
+void swap(List<T, Alloc>& lhs, List<T, Alloc>& rhs)
+{
+	lhs.swap(rhs);
+}
+
+// Existing nodes are reused: their values are copy-assigned in place, and only
+// the difference in length is allocated or freed.
+template<typename T, typename Alloc>
+List<T, Alloc>& List<T, Alloc>::operator=(const List& other)
+{
+	if (this == &other) return *this;
+
+	if constexpr (AllocTraits::propagate_on_container_copy_assignment::value)
+	{
+		// Nodes of the old allocator cannot be kept.
+		if (_alloc != other._alloc)
+			clear();
+
+		_alloc = other._alloc;
+	}
+
+	NodeBase* curr = _sentinel._next;
+	const NodeBase* otherCurr = other._sentinel._next;
+	for (; curr != &_sentinel && otherCurr != &other._sentinel; curr = curr->_next, otherCurr = otherCurr->_next)
+		value(curr) = value(otherCurr);
+
+	if (otherCurr == &other._sentinel)
+		erase_nodes(curr, &_sentinel);
+	else
+	{
+		reserve_chain(other._size - _size);
+		link_chain(&_sentinel, make_chain(const_iterator(otherCurr), other.end()));
+	}
+
+	return *this;
+}
+
+// With a propagating or equal allocator the nodes change hands;
+// otherwise the memory cannot be adopted and the elements are moved one by one.
+template<typename T, typename Alloc>
+List<T, Alloc>& List<T, Alloc>::operator=(List&& other) noexcept(AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value)
 {
 	if (this == &other) return *this;
 
 	clear();
 
-	Node* curr = other._head->_next;
-	while (curr != other._tail)
+	if constexpr (AllocTraits::propagate_on_container_move_assignment::value)
+	{
+		using std::swap;
+		swap(_alloc, other._alloc);
+	}
+	else if (!AllocTraits::is_always_equal::value && _alloc != other._alloc)
 	{
-		push_back(*(curr->_val));
-		curr = curr->_next;
+		for (NodeBase* curr = other._sentinel._next; curr != &other._sentinel; curr = curr->_next)
+			push_back(std::move(value(curr)));
+
+		other.clear();
+		return *this;
 	}
 
+	swap_nodes(other);
+
 	return *this;
 }
 
@@ -569,54 +1892,54 @@ List<T>& List<T>::operator=(const List& other)
 
 #pragma region Iterator
 
-template<typename T>
-List<T>::iterator List<T>::begin()
+template<typename T, typename Alloc>
+List<T, Alloc>::iterator List<T, Alloc>::begin()
 {
-	return iterator(_head->_next);
+	return iterator(_sentinel._next);
 }
 
-template<typename T>
-List<T>::iterator List<T>::end()
+template<typename T, typename Alloc>
+List<T, Alloc>::iterator List<T, Alloc>::end()
 {
-	return iterator(_tail);
+	return iterator(&_sentinel);
 }
 
-template<typename T>
-List<T>::iterator::reference List<T>::iterator::operator*() const
+template<typename T, typename Alloc>
+List<T, Alloc>::iterator::reference List<T, Alloc>::iterator::operator*() const
 {
-	return *(_current->_val);
+	return value(_current);
 }
 
-template<typename T>
-List<T>::iterator::pointer List<T>::iterator::operator->() const
+template<typename T, typename Alloc>
+List<T, Alloc>::iterator::pointer List<T, Alloc>::iterator::operator->() const
 {
-	return _current->_val;
+	return std::addressof(value(_current));
 }
 
-template<typename T>
-List<T>::iterator& List<T>::iterator::operator++()
+template<typename T, typename Alloc>
+List<T, Alloc>::iterator& List<T, Alloc>::iterator::operator++()
 {
 	_current = _current->_next;
 	return *this;
 }
 
-template<typename T>
-List<T>::iterator List<T>::iterator::operator++(int)
+template<typename T, typename Alloc>
+List<T, Alloc>::iterator List<T, Alloc>::iterator::operator++(int)
 {
 	iterator result(*this);
 	++(*this);
 	return result;
 }
 
-template<typename T>
-List<T>::iterator& List<T>::iterator::operator--()
+template<typename T, typename Alloc>
+List<T, Alloc>::iterator& List<T, Alloc>::iterator::operator--()
 {
 	_current = _current->_prev;
 	return *this;
 }
 
-template<typename T>
-List<T>::iterator List<T>::iterator::operator--(int)
+template<typename T, typename Alloc>
+List<T, Alloc>::iterator List<T, Alloc>::iterator::operator--(int)
 {
 	iterator result(*this);
 	--(*this);
@@ -624,20 +1947,20 @@ List<T>::iterator List<T>::iterator::operator--(int)
 }
 
 
-template<typename T>
-bool List<T>::iterator::operator==(const List<T>::iterator& other) const
+template<typename T, typename Alloc>
+bool List<T, Alloc>::iterator::operator==(const List<T, Alloc>::iterator& other) const
 {
 	return this->_current == other._current;
 }
 
-template<typename T>
-bool List<T>::iterator::operator!=(const List<T>::iterator& other) const
+template<typename T, typename Alloc>
+bool List<T, Alloc>::iterator::operator!=(const List<T, Alloc>::iterator& other) const
 {
 	return this->_current != other._current;
 }
 
-template<typename T>
-List<T>::iterator& List<T>::iterator::operator=(const iterator& source)
+template<typename T, typename Alloc>
+List<T, Alloc>::iterator& List<T, Alloc>::iterator::operator=(const iterator& source)
 {
 	this->_current = source._current;
 	return *this;
@@ -647,74 +1970,74 @@ List<T>::iterator& List<T>::iterator::operator=(const iterator& source)
 
 #pragma region Reverse Iterator
 
-template<typename T>
-List<T>::reverse_iterator List<T>::rbegin()
+template<typename T, typename Alloc>
+List<T, Alloc>::reverse_iterator List<T, Alloc>::rbegin()
 {
-	return reverse_iterator(_tail->_prev);
+	return reverse_iterator(_sentinel._prev);
 }
 
-template<typename T>
-List<T>::reverse_iterator List<T>::rend()
+template<typename T, typename Alloc>
+List<T, Alloc>::reverse_iterator List<T, Alloc>::rend()
 {
-	return reverse_iterator(_head);
+	return reverse_iterator(&_sentinel);
 }
 
-template<typename T>
-List<T>::reverse_iterator::reference List<T>::reverse_iterator::operator*() const
+template<typename T, typename Alloc>
+List<T, Alloc>::reverse_iterator::reference List<T, Alloc>::reverse_iterator::operator*() const
 {
-	return *(_current->_val);
+	return value(_current);
 }
 
-template<typename T>
-List<T>::reverse_iterator::pointer List<T>::reverse_iterator::operator->() const
+template<typename T, typename Alloc>
+List<T, Alloc>::reverse_iterator::pointer List<T, Alloc>::reverse_iterator::operator->() const
 {
-	return _current->_val;
+	return std::addressof(value(_current));
 }
 
-template<typename T>
-List<T>::reverse_iterator& List<T>::reverse_iterator::operator++()
+template<typename T, typename Alloc>
+List<T, Alloc>::reverse_iterator& List<T, Alloc>::reverse_iterator::operator++()
 {
 	_current = _current->_prev;
 	return *this;
 }
 
-template<typename T>
-List<T>::reverse_iterator List<T>::reverse_iterator::operator++(int)
+template<typename T, typename Alloc>
+List<T, Alloc>::reverse_iterator List<T, Alloc>::reverse_iterator::operator++(int)
 {
 	reverse_iterator result(*this);
 	++(*this);
 	return result;
 }
 
-template<typename T>
-List<T>::reverse_iterator& List<T>::reverse_iterator::operator--()
+template<typename T, typename Alloc>
+List<T, Alloc>::reverse_iterator& List<T, Alloc>::reverse_iterator::operator--()
 {
 	_current = _current->_next;
 	return *this;
 }
 
-template<typename T>
-List<T>::reverse_iterator List<T>::reverse_iterator::operator--(int)
+template<typename T, typename Alloc>
+List<T, Alloc>::reverse_iterator List<T, Alloc>::reverse_iterator::operator--(int)
 {
 	reverse_iterator result(*this);
 	--(*this);
 	return result;
 }
 
-template<typename T>
-bool List<T>::reverse_iterator::operator==(const List<T>::reverse_iterator& other) const
+template<typename T, typename Alloc>
+bool List<T, Alloc>::reverse_iterator::operator==(const List<T, Alloc>::reverse_iterator& other) const
 {
 	return this->_current == other._current;
 }
 
-template<typename T>
-bool List<T>::reverse_iterator::operator!=(const List<T>::reverse_iterator& other) const
+template<typename T, typename Alloc>
+bool List<T, Alloc>::reverse_iterator::operator!=(const List<T, Alloc>::reverse_iterator& other) const
 {
 	return this->_current != other._current;
 }
 
-template<typename T>
-List<T>::reverse_iterator& List<T>::reverse_iterator::operator=(const reverse_iterator& source)
+template<typename T, typename Alloc>
+List<T, Alloc>::reverse_iterator& List<T, Alloc>::reverse_iterator::operator=(const reverse_iterator& source)
 {
 	this->_current = source._current;
 	return *this;
@@ -725,86 +2048,86 @@ List<T>::reverse_iterator& List<T>::reverse_iterator::operator=(const reverse_it
 
 #pragma region Const Iterator
 
-template<typename T>
-List<T>::const_iterator List<T>::begin() const
+template<typename T, typename Alloc>
+List<T, Alloc>::const_iterator List<T, Alloc>::begin() const
 {
-	return const_iterator(_head->_next);
+	return const_iterator(_sentinel._next);
 }
 
-template<typename T>
-List<T>::const_iterator List<T>::end() const
+template<typename T, typename Alloc>
+List<T, Alloc>::const_iterator List<T, Alloc>::end() const
 {
-	return const_iterator(_tail);
+	return const_iterator(&_sentinel);
 }
 
-template<typename T>
-List<T>::const_iterator List<T>::cbegin() const
+template<typename T, typename Alloc>
+List<T, Alloc>::const_iterator List<T, Alloc>::cbegin() const
 {
-	return const_iterator(_head->_next);
+	return const_iterator(_sentinel._next);
 }
 
-template<typename T>
-List<T>::const_iterator List<T>::cend() const
+template<typename T, typename Alloc>
+List<T, Alloc>::const_iterator List<T, Alloc>::cend() const
 {
-	return const_iterator(_tail);
+	return const_iterator(&_sentinel);
 }
 
-template<typename T>
-List<T>::const_iterator::reference List<T>::const_iterator::operator*() const
+template<typename T, typename Alloc>
+List<T, Alloc>::const_iterator::reference List<T, Alloc>::const_iterator::operator*() const
 {
-	return *(_current->_val);
+	return value(_current);
 }
 
-template<typename T>
-List<T>::const_iterator::pointer List<T>::const_iterator::operator->() const
+template<typename T, typename Alloc>
+List<T, Alloc>::const_iterator::pointer List<T, Alloc>::const_iterator::operator->() const
 {
-	return _current->_val;
+	return std::addressof(value(_current));
 }
 
-template<typename T>
-List<T>::const_iterator& List<T>::const_iterator::operator++()
+template<typename T, typename Alloc>
+List<T, Alloc>::const_iterator& List<T, Alloc>::const_iterator::operator++()
 {
 	_current = _current->_next;
 	return *this;
 }
 
-template<typename T>
-List<T>::const_iterator List<T>::const_iterator::operator++(int)
+template<typename T, typename Alloc>
+List<T, Alloc>::const_iterator List<T, Alloc>::const_iterator::operator++(int)
 {
 	const_iterator result(*this);
 	++(*this);
 	return result;
 }
 
-template<typename T>
-List<T>::const_iterator& List<T>::const_iterator::operator--()
+template<typename T, typename Alloc>
+List<T, Alloc>::const_iterator& List<T, Alloc>::const_iterator::operator--()
 {
 	_current = _current->_prev;
 	return *this;
 }
 
-template<typename T>
-List<T>::const_iterator List<T>::const_iterator::operator--(int)
+template<typename T, typename Alloc>
+List<T, Alloc>::const_iterator List<T, Alloc>::const_iterator::operator--(int)
 {
 	const_iterator result(*this);
 	--(*this);
 	return result;
 }
 
-template<typename T>
-bool List<T>::const_iterator::operator==(const List<T>::const_iterator& other) const
+template<typename T, typename Alloc>
+bool List<T, Alloc>::const_iterator::operator==(const List<T, Alloc>::const_iterator& other) const
 {
 	return this->_current == other._current;
 }
 
-template<typename T>
-bool List<T>::const_iterator::operator!=(const List<T>::const_iterator& other) const
+template<typename T, typename Alloc>
+bool List<T, Alloc>::const_iterator::operator!=(const List<T, Alloc>::const_iterator& other) const
 {
 	return this->_current != other._current;
 }
 
-template<typename T>
-List<T>::const_iterator& List<T>::const_iterator::operator=(const const_iterator& source)
+template<typename T, typename Alloc>
+List<T, Alloc>::const_iterator& List<T, Alloc>::const_iterator::operator=(const const_iterator& source)
 {
 	this->_current = source._current;
 	return *this;
@@ -814,86 +2137,86 @@ List<T>::const_iterator& List<T>::const_iterator::operator=(const const_iterator
 
 #pragma region Const Reverse Iterator
 
-template<typename T>
-List<T>::const_reverse_iterator List<T>::rbegin() const
+template<typename T, typename Alloc>
+List<T, Alloc>::const_reverse_iterator List<T, Alloc>::rbegin() const
 {
-	return const_reverse_iterator(_tail->_prev);
+	return const_reverse_iterator(_sentinel._prev);
 }
 
-template<typename T>
-List<T>::const_reverse_iterator List<T>::rend() const
+template<typename T, typename Alloc>
+List<T, Alloc>::const_reverse_iterator List<T, Alloc>::rend() const
 {
-	return const_reverse_iterator(_head);
+	return const_reverse_iterator(&_sentinel);
 }
 
-template<typename T>
-List<T>::const_reverse_iterator List<T>::crbegin() const
+template<typename T, typename Alloc>
+List<T, Alloc>::const_reverse_iterator List<T, Alloc>::crbegin() const
 {
-	return const_reverse_iterator(_tail->_prev);
+	return const_reverse_iterator(_sentinel._prev);
 }
 
-template<typename T>
-List<T>::const_reverse_iterator List<T>::crend() const
+template<typename T, typename Alloc>
+List<T, Alloc>::const_reverse_iterator List<T, Alloc>::crend() const
 {
-	return const_reverse_iterator(_head);
+	return const_reverse_iterator(&_sentinel);
 }
 
-template<typename T>
-List<T>::const_reverse_iterator::reference List<T>::const_reverse_iterator::operator*() const
+template<typename T, typename Alloc>
+List<T, Alloc>::const_reverse_iterator::reference List<T, Alloc>::const_reverse_iterator::operator*() const
 {
-	return *(_current->_val);
+	return value(_current);
 }
 
-template<typename T>
-List<T>::const_reverse_iterator::pointer List<T>::const_reverse_iterator::operator->() const
+template<typename T, typename Alloc>
+List<T, Alloc>::const_reverse_iterator::pointer List<T, Alloc>::const_reverse_iterator::operator->() const
 {
-	return _current->_val;
+	return std::addressof(value(_current));
 }
 
-template<typename T>
-List<T>::const_reverse_iterator& List<T>::const_reverse_iterator::operator++()
+template<typename T, typename Alloc>
+List<T, Alloc>::const_reverse_iterator& List<T, Alloc>::const_reverse_iterator::operator++()
 {
 	_current = _current->_prev;
 	return *this;
 }
 
-template<typename T>
-List<T>::const_reverse_iterator List<T>::const_reverse_iterator::operator++(int)
+template<typename T, typename Alloc>
+List<T, Alloc>::const_reverse_iterator List<T, Alloc>::const_reverse_iterator::operator++(int)
 {
 	const_reverse_iterator result(*this);
 	++(*this);
 	return result;
 }
 
-template<typename T>
-List<T>::const_reverse_iterator& List<T>::const_reverse_iterator::operator--()
+template<typename T, typename Alloc>
+List<T, Alloc>::const_reverse_iterator& List<T, Alloc>::const_reverse_iterator::operator--()
 {
 	_current = _current->_next;
 	return *this;
 }
 
-template<typename T>
-List<T>::const_reverse_iterator List<T>::const_reverse_iterator::operator--(int)
+template<typename T, typename Alloc>
+List<T, Alloc>::const_reverse_iterator List<T, Alloc>::const_reverse_iterator::operator--(int)
 {
 	const_reverse_iterator result(*this);
 	--(*this);
 	return result;
 }
 
-template<typename T>
-bool List<T>::const_reverse_iterator::operator==(const List<T>::const_reverse_iterator& other) const
+template<typename T, typename Alloc>
+bool List<T, Alloc>::const_reverse_iterator::operator==(const List<T, Alloc>::const_reverse_iterator& other) const
 {
 	return this->_current == other._current;
 }
 
-template<typename T>
-bool List<T>::const_reverse_iterator::operator!=(const List<T>::const_reverse_iterator& other) const
+template<typename T, typename Alloc>
+bool List<T, Alloc>::const_reverse_iterator::operator!=(const List<T, Alloc>::const_reverse_iterator& other) const
 {
 	return this->_current != other._current;
 }
 
-template<typename T>
-List<T>::const_reverse_iterator& List<T>::const_reverse_iterator::operator=(const const_reverse_iterator& source)
+template<typename T, typename Alloc>
+List<T, Alloc>::const_reverse_iterator& List<T, Alloc>::const_reverse_iterator::operator=(const const_reverse_iterator& source)
 {
 	this->_current = source._current;
 	return *this;
@@ -902,5 +2225,8 @@ List<T>::const_reverse_iterator& List<T>::const_reverse_iterator::operator=(cons
 
 #pragma endregion
 
-
-
+namespace pmr
+{
+	template <typename T>
+	using List = ::List<T, std::pmr::polymorphic_allocator<T>>;
+}
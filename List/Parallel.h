@@ -0,0 +1,218 @@
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace detail
+{
+
+#pragma region WorkerPool
+
+	// Threads kept alive between calls of the parallel list algorithms, so that a
+	// sort or traversal does not start threads of its own. A job is a number of
+	// tasks that idle pool threads and the submitting thread take one by one; as
+	// the submitter keeps taking tasks until none are left, a job finishes even
+	// when every pool thread is busy, including jobs submitted from inside a task.
+	class WorkerPool
+	{
+
+	private:
+
+		struct Job
+		{
+			const void* _task;
+			void (*_call)(const void* task, size_t index);
+			size_t _count;
+			size_t _next;
+			size_t _done;
+		};
+
+		std::mutex _mutex;
+		std::condition_variable _work;
+		std::condition_variable _finished;
+		std::deque<Job*> _jobs;
+		std::vector<std::thread> _threads;
+		bool _stop;
+
+		WorkerPool();
+
+		void grow(size_t threads);
+		size_t claim(Job& job);
+		void work();
+
+	public:
+
+		WorkerPool(const WorkerPool&) = delete;
+		WorkerPool& operator=(const WorkerPool&) = delete;
+		~WorkerPool();
+
+		static WorkerPool& instance();
+
+		// Calls task(i), which must not throw, for every i in [0, count) on the
+		// calling thread and up to count - 1 pool threads, and returns once all
+		// calls have returned. The pool grows to count - 1 threads if it can; if a
+		// thread cannot be started, the threads it has do the work.
+		template <typename Task>
+		void run(size_t count, const Task& task);
+
+		// Threads started so far; they are only stopped at program exit.
+		size_t size();
+	};
+
+#pragma endregion
+
+}// namespace detail
+
+#pragma region WorkerPool
+
+inline detail::WorkerPool::WorkerPool() : _stop(false) { }
+
+inline detail::WorkerPool::~WorkerPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_stop = true;
+	}
+
+	_work.notify_all();
+	for (std::thread& thread : _threads)
+		thread.join();
+}
+
+inline detail::WorkerPool& detail::WorkerPool::instance()
+{
+	static WorkerPool pool;
+	return pool;
+}
+
+// Called with _mutex held.
+inline void detail::WorkerPool::grow(size_t threads)
+{
+	try
+	{
+		while (_threads.size() < threads)
+			_threads.emplace_back(&WorkerPool::work, this);
+	}
+	catch (...)
+	{
+	}
+}
+
+// Takes the next task of a queued job, and takes the job off the queue once its
+// last task is taken. Called with _mutex held.
+inline size_t detail::WorkerPool::claim(Job& job)
+{
+	size_t index = job._next++;
+	if (job._next == job._count)
+		_jobs.erase(std::find(_jobs.begin(), _jobs.end(), &job));
+
+	return index;
+}
+
+inline void detail::WorkerPool::work()
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+	while (true)
+	{
+		_work.wait(lock, [this] { return _stop || !_jobs.empty(); });
+		if (_stop)
+			return;
+
+		Job& job = *_jobs.front();
+		size_t index = claim(job);
+
+		lock.unlock();
+		job._call(job._task, index);
+		lock.lock();
+
+		if (++job._done == job._count)
+			_finished.notify_all();
+	}
+}
+
+template <typename Task>
+void detail::WorkerPool::run(size_t count, const Task& task)
+{
+	Job job{ &task, [](const void* erased, size_t index) { (*static_cast<const Task*>(erased))(index); }, count, 0, 0 };
+
+	std::unique_lock<std::mutex> lock(_mutex);
+	grow(count - 1);
+	_jobs.push_back(&job);
+	_work.notify_all();
+
+	while (job._next < job._count)
+	{
+		size_t index = claim(job);
+
+		lock.unlock();
+		task(index);
+		lock.lock();
+
+		++job._done;
+	}
+
+	_finished.wait(lock, [&job] { return job._done == job._count; });
+}
+
+inline size_t detail::WorkerPool::size()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _threads.size();
+}
+
+#pragma endregion
+
+namespace detail
+{
+	// Fork-join helper for the parallel list algorithms: calls task(i) for every i
+	// in [0, count) on the calling thread and the threads of the WorkerPool, and
+	// returns once all of them have finished. The first exception thrown by a task
+	// is rethrown after the join.
+	template <typename Task>
+	void fork_join(size_t count, const Task& task)
+	{
+		if (count == 0)
+			return;
+
+		std::vector<std::exception_ptr> errors(count);
+		auto guarded = [&](size_t i)
+		{
+			try
+			{
+				task(i);
+			}
+			catch (...)
+			{
+				errors[i] = std::current_exception();
+			}
+		};
+
+		if (count == 1)
+			guarded(0);
+		else
+			WorkerPool::instance().run(count, guarded);
+
+		for (const std::exception_ptr& error : errors)
+		{
+			if (error)
+				std::rethrow_exception(error);
+		}
+	}
+
+	// Number of workers to use for `size` elements when each one should get at
+	// least `grain` of them; `threads` == 0 means one per hardware thread.
+	inline size_t worker_count(size_t threads, size_t size, size_t grain)
+	{
+		if (threads == 0)
+			threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+
+		size_t byGrain = grain != 0 ? size / grain : size;
+		return std::max<size_t>(std::min(threads, byGrain), 1);
+	}
+}
@@ -0,0 +1,368 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace detail
+{
+
+#pragma region NodePool
+
+	// Fixed-size block pool: blocks are carved from contiguous slabs and recycled
+	// through an intrusive free list threaded through the free blocks themselves.
+	// Not thread-safe; a pool belongs to the containers sharing its allocator.
+	class NodePool
+	{
+
+	private:
+
+		struct FreeBlock
+		{
+			FreeBlock* _next;
+		};
+
+		struct Slab
+		{
+			std::byte* _begin;
+			size_t _blocks;
+		};
+
+		size_t _blockSize;
+		size_t _alignment;
+		size_t _slabBlocks;
+		FreeBlock* _free;
+		size_t _freeCount;
+		std::vector<Slab> _slabs;
+
+		void add_slab(size_t blocks);
+		void release_slab(const Slab& slab);
+
+	public:
+
+		NodePool(size_t blockSize, size_t alignment, size_t slabBlocks);
+		NodePool(const NodePool&) = delete;
+		NodePool& operator=(const NodePool&) = delete;
+		~NodePool();
+
+		static size_t round_block_size(size_t size, size_t alignment);
+
+		size_t block_size() const;
+		size_t alignment() const;
+		size_t free_blocks() const;
+		size_t slab_count() const;
+
+		void* allocate();
+		void deallocate(void* block);
+		void reserve(size_t blocks);
+		void shrink_to_fit();
+	};
+
+#pragma endregion
+
+#pragma region PoolResource
+
+	// The state shared by a PoolAllocator and all of its copies and rebinds:
+	// one NodePool per distinct block size requested through it.
+	class PoolResource
+	{
+
+	private:
+
+		size_t _slabBlocks;
+		std::vector<std::unique_ptr<NodePool>> _pools;
+
+	public:
+
+		PoolResource(size_t slabBlocks);
+
+		NodePool& pool_for(size_t size, size_t alignment);
+		size_t slab_count() const;
+		void shrink_to_fit();
+	};
+
+#pragma endregion
+
+}// namespace detail
+
+// Allocator handing out single objects from a slab pool, intended for List nodes:
+// List<T, PoolAllocator<T>> performs no upstream allocation once the pool has
+// grown to the list's working size, and List::shrink_to_fit() returns empty slabs.
+// Requests for more than one object go straight to the global operator new.
+template <typename T, size_t SlabBlocks = 256>
+class PoolAllocator
+{
+
+private:
+
+	std::shared_ptr<detail::PoolResource> _resource;
+	detail::NodePool* _pool;
+
+	template <typename U, size_t N>
+	friend class PoolAllocator;
+
+public:
+
+	using value_type = T;
+	using propagate_on_container_copy_assignment = std::false_type;
+	using propagate_on_container_move_assignment = std::true_type;
+	using propagate_on_container_swap = std::true_type;
+	using is_always_equal = std::false_type;
+
+	template <typename U>
+	struct rebind
+	{
+		using other = PoolAllocator<U, SlabBlocks>;
+	};
+
+	PoolAllocator();
+	PoolAllocator(const PoolAllocator& other) = default;
+	template <typename U>
+	PoolAllocator(const PoolAllocator<U, SlabBlocks>& other);
+
+	// Declared so that "moving" copies: a moved-from allocator must still compare
+	// equal to the one constructed from it.
+	PoolAllocator& operator=(const PoolAllocator& other) = default;
+
+	T* allocate(size_t n);
+	void deallocate(T* ptr, size_t n);
+
+	void reserve(size_t n);
+	void shrink_to_fit();
+	size_t slab_count() const;
+
+	PoolAllocator select_on_container_copy_construction() const;
+
+	template <typename U>
+	bool operator==(const PoolAllocator<U, SlabBlocks>& other) const;
+};
+
+#pragma region NodePool
+
+inline detail::NodePool::NodePool(size_t blockSize, size_t alignment, size_t slabBlocks)
+	: _blockSize(round_block_size(blockSize, alignment)), _alignment(std::max(alignment, alignof(FreeBlock))),
+	_slabBlocks(slabBlocks), _free(nullptr), _freeCount(0) { }
+
+inline size_t detail::NodePool::round_block_size(size_t size, size_t alignment)
+{
+	alignment = std::max(alignment, alignof(FreeBlock));
+	size = std::max(size, sizeof(FreeBlock));
+	return (size + alignment - 1) / alignment * alignment;
+}
+
+inline detail::NodePool::~NodePool()
+{
+	for (const Slab& slab : _slabs)
+		release_slab(slab);
+}
+
+inline size_t detail::NodePool::block_size() const
+{
+	return _blockSize;
+}
+
+inline size_t detail::NodePool::alignment() const
+{
+	return _alignment;
+}
+
+inline size_t detail::NodePool::free_blocks() const
+{
+	return _freeCount;
+}
+
+inline size_t detail::NodePool::slab_count() const
+{
+	return _slabs.size();
+}
+
+inline void detail::NodePool::add_slab(size_t blocks)
+{
+	std::byte* begin = static_cast<std::byte*>(::operator new(blocks * _blockSize, std::align_val_t(_alignment)));
+	_slabs.push_back({ begin, blocks });
+
+	// Pushed back to front so that allocation hands blocks out in address order.
+	for (size_t i = blocks; i-- > 0;)
+	{
+		FreeBlock* block = ::new (static_cast<void*>(begin + i * _blockSize)) FreeBlock{ _free };
+		_free = block;
+	}
+
+	_freeCount += blocks;
+}
+
+inline void detail::NodePool::release_slab(const Slab& slab)
+{
+	::operator delete(slab._begin, slab._blocks * _blockSize, std::align_val_t(_alignment));
+}
+
+inline void* detail::NodePool::allocate()
+{
+	if (_free == nullptr)
+		add_slab(_slabBlocks);
+
+	FreeBlock* block = _free;
+	_free = block->_next;
+	--_freeCount;
+
+	return block;
+}
+
+inline void detail::NodePool::deallocate(void* block)
+{
+	_free = ::new (block) FreeBlock{ _free };
+	++_freeCount;
+}
+
+inline void detail::NodePool::reserve(size_t blocks)
+{
+	if (blocks > _freeCount)
+		add_slab(std::max(blocks - _freeCount, _slabBlocks));
+}
+
+inline void detail::NodePool::shrink_to_fit()
+{
+	if (_freeCount == 0)
+		return;
+
+	std::sort(_slabs.begin(), _slabs.end(), [](const Slab& lhs, const Slab& rhs) { return lhs._begin < rhs._begin; });
+
+	auto slabOf = [this](const FreeBlock* block)
+	{
+		auto it = std::upper_bound(_slabs.begin(), _slabs.end(), reinterpret_cast<const std::byte*>(block),
+			[](const std::byte* address, const Slab& slab) { return address < slab._begin; });
+		return static_cast<size_t>(it - _slabs.begin() - 1);
+	};
+
+	std::vector<size_t> freeInSlab(_slabs.size(), 0);
+	for (FreeBlock* block = _free; block != nullptr; block = block->_next)
+		++freeInSlab[slabOf(block)];
+
+	// Drop the free blocks of fully free slabs from the free list, then the slabs.
+	FreeBlock** link = &_free;
+	while (*link != nullptr)
+	{
+		size_t slab = slabOf(*link);
+		if (freeInSlab[slab] == _slabs[slab]._blocks)
+		{
+			*link = (*link)->_next;
+			--_freeCount;
+		}
+		else
+			link = &(*link)->_next;
+	}
+
+	size_t kept = 0;
+	for (size_t i = 0; i < _slabs.size(); ++i)
+	{
+		if (freeInSlab[i] == _slabs[i]._blocks)
+			release_slab(_slabs[i]);
+		else
+			_slabs[kept++] = _slabs[i];
+	}
+
+	_slabs.resize(kept);
+}
+
+#pragma endregion
+
+#pragma region PoolResource
+
+inline detail::PoolResource::PoolResource(size_t slabBlocks) : _slabBlocks(slabBlocks) { }
+
+inline detail::NodePool& detail::PoolResource::pool_for(size_t size, size_t alignment)
+{
+	for (const auto& pool : _pools)
+	{
+		if (pool->block_size() == NodePool::round_block_size(size, alignment) && pool->alignment() >= alignment)
+			return *pool;
+	}
+
+	_pools.push_back(std::make_unique<NodePool>(size, alignment, _slabBlocks));
+	return *_pools.back();
+}
+
+inline size_t detail::PoolResource::slab_count() const
+{
+	size_t count = 0;
+	for (const auto& pool : _pools)
+		count += pool->slab_count();
+
+	return count;
+}
+
+inline void detail::PoolResource::shrink_to_fit()
+{
+	for (const auto& pool : _pools)
+		pool->shrink_to_fit();
+}
+
+#pragma endregion
+
+#pragma region PoolAllocator
+
+template<typename T, size_t SlabBlocks>
+PoolAllocator<T, SlabBlocks>::PoolAllocator()
+	: _resource(std::make_shared<detail::PoolResource>(SlabBlocks)), _pool(&_resource->pool_for(sizeof(T), alignof(T))) { }
+
+template<typename T, size_t SlabBlocks>
+template<typename U>
+PoolAllocator<T, SlabBlocks>::PoolAllocator(const PoolAllocator<U, SlabBlocks>& other)
+	: _resource(other._resource), _pool(&_resource->pool_for(sizeof(T), alignof(T))) { }
+
+template<typename T, size_t SlabBlocks>
+T* PoolAllocator<T, SlabBlocks>::allocate(size_t n)
+{
+	if (n != 1)
+		return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(alignof(T))));
+
+	return static_cast<T*>(_pool->allocate());
+}
+
+template<typename T, size_t SlabBlocks>
+void PoolAllocator<T, SlabBlocks>::deallocate(T* ptr, size_t n)
+{
+	if (n != 1)
+	{
+		::operator delete(ptr, n * sizeof(T), std::align_val_t(alignof(T)));
+		return;
+	}
+
+	_pool->deallocate(ptr);
+}
+
+template<typename T, size_t SlabBlocks>
+void PoolAllocator<T, SlabBlocks>::reserve(size_t n)
+{
+	_pool->reserve(n);
+}
+
+template<typename T, size_t SlabBlocks>
+void PoolAllocator<T, SlabBlocks>::shrink_to_fit()
+{
+	_resource->shrink_to_fit();
+}
+
+template<typename T, size_t SlabBlocks>
+size_t PoolAllocator<T, SlabBlocks>::slab_count() const
+{
+	return _resource->slab_count();
+}
+
+template<typename T, size_t SlabBlocks>
+PoolAllocator<T, SlabBlocks> PoolAllocator<T, SlabBlocks>::select_on_container_copy_construction() const
+{
+	return PoolAllocator();
+}
+
+template<typename T, size_t SlabBlocks>
+template<typename U>
+bool PoolAllocator<T, SlabBlocks>::operator==(const PoolAllocator<U, SlabBlocks>& other) const
+{
+	return _resource == other._resource;
+}
+
+#pragma endregion
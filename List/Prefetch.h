@@ -0,0 +1,42 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_MSC_VER) && !defined(__clang__) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
+
+namespace detail
+{
+	constexpr size_t cache_line = 64;
+
+	// Lines fetched ahead for one object at most; beyond that the hardware
+	// prefetcher picks up the sequential access on its own.
+	constexpr size_t max_prefetch_lines = 4;
+
+	// Asks the processor to start loading the cache lines holding the first bytes of
+	// [ptr, ptr + size) without waiting for them. A hint only: it never faults and
+	// does nothing on compilers without a prefetch intrinsic, or when
+	// LIST_NO_PREFETCH is defined.
+	inline void prefetch(const void* ptr, size_t size)
+	{
+#if !defined(LIST_NO_PREFETCH)
+		uintptr_t begin = reinterpret_cast<uintptr_t>(ptr);
+		uintptr_t end = begin + std::min(size, max_prefetch_lines * cache_line);
+
+		for (uintptr_t line = begin & ~(cache_line - 1); line < end; line += cache_line)
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			__builtin_prefetch(reinterpret_cast<const void*>(line));
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+			_mm_prefetch(reinterpret_cast<const char*>(line), _MM_HINT_T0);
+#endif
+		}
+#else
+		(void)ptr;
+		(void)size;
+#endif
+	}
+}
@@ -0,0 +1,134 @@
+#pragma once
+
+#include "InlineAllocator.h"
+#include "List.h"
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+
+namespace detail
+{
+	// One block per node of the List that SmallList derives from, sized from that
+	// List itself so the two cannot drift apart.
+	template <typename T, size_t N>
+	using SmallListStorage = InlineStorage<List<T, InlineAllocator<T>>::node_size, List<T, InlineAllocator<T>>::node_alignment, N>;
+}
+
+// A List whose first N nodes live in a buffer inside the list object; further
+// nodes come from the heap, and freed inline nodes are reused first. A list that
+// never holds more than N elements at once makes no heap allocation.
+//
+// Every SmallList has its own buffer, so nodes never change owner between two of
+// them: copy, move, swap and splice move or copy the elements instead of
+// relinking nodes, which makes them linear rather than constant time. Moving a
+// SmallList into a plain List<T, InlineAllocator<T>> is not supported, since the
+// nodes would outlive the buffer.
+template <typename T, size_t N = 8>
+class SmallList : private detail::SmallListStorage<T, N>, public List<T, InlineAllocator<T>>
+{
+
+private:
+
+	using Base = List<T, InlineAllocator<T>>;
+
+	InlineAllocator<T> inline_allocator();
+
+public:
+
+	static constexpr size_t inline_capacity = N;
+
+	SmallList();
+	explicit SmallList(size_t size);
+	SmallList(size_t size, const T& val);
+	SmallList(std::initializer_list<T> initList);
+	template <std::input_iterator iter>
+	SmallList(iter begin, iter end);
+	SmallList(const SmallList& other);
+	SmallList(SmallList&& other);
+
+	size_t inline_free() const;
+
+	void swap(SmallList& other);
+
+	SmallList& operator=(const SmallList& other);
+	SmallList& operator=(SmallList&& other);
+};
+
+#pragma region CtorsAndDestructors
+
+template<typename T, size_t N>
+SmallList<T, N>::SmallList() : Base(inline_allocator()) { }
+
+template<typename T, size_t N>
+SmallList<T, N>::SmallList(size_t size) : Base(size, inline_allocator()) { }
+
+template<typename T, size_t N>
+SmallList<T, N>::SmallList(size_t size, const T& val) : Base(size, val, inline_allocator()) { }
+
+template<typename T, size_t N>
+SmallList<T, N>::SmallList(std::initializer_list<T> initList) : Base(initList, inline_allocator()) { }
+
+template<typename T, size_t N>
+template<std::input_iterator iter>
+SmallList<T, N>::SmallList(iter begin, iter end) : Base(begin, end, inline_allocator()) { }
+
+template<typename T, size_t N>
+SmallList<T, N>::SmallList(const SmallList& other) : Base(other, inline_allocator()) { }
+
+template<typename T, size_t N>
+SmallList<T, N>::SmallList(SmallList&& other) : Base(inline_allocator())
+{
+	Base::splice(this->end(), other);
+}
+
+#pragma endregion
+
+#pragma region Xary
+
+// The storage base is constructed before List, so its arena can be handed to it.
+template<typename T, size_t N>
+InlineAllocator<T> SmallList<T, N>::inline_allocator()
+{
+	return InlineAllocator<T>(&this->_arena);
+}
+
+// Number of nodes that can still be created without touching the heap.
+template<typename T, size_t N>
+size_t SmallList<T, N>::inline_free() const
+{
+	return this->_arena.free_blocks();
+}
+
+template<typename T, size_t N>
+void SmallList<T, N>::swap(SmallList& other)
+{
+	Base::swap(other);
+}
+
+#pragma endregion
+
+#pragma region Operators
+
+template<typename T, size_t N>
+void swap(SmallList<T, N>& lhs, SmallList<T, N>& rhs)
+{
+	lhs.swap(rhs);
+}
+
+template<typename T, size_t N>
+SmallList<T, N>& SmallList<T, N>::operator=(const SmallList& other)
+{
+	Base::operator=(other);
+	return *this;
+}
+
+template<typename T, size_t N>
+SmallList<T, N>& SmallList<T, N>::operator=(SmallList&& other)
+{
+	Base::operator=(std::move(other));
+	return *this;
+}
+
+#pragma endregion
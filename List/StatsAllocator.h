@@ -0,0 +1,206 @@
+#pragma once
+
+#include "List.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+// Counters kept by a StatsAllocator. Memory figures count what went through the
+// allocator; the operation counters are the events a List reports to it.
+struct ListStats
+{
+	size_t live_nodes = 0;
+	size_t bytes_in_use = 0;
+	size_t peak_bytes = 0;
+	size_t allocations = 0;
+	size_t deallocations = 0;
+
+	size_t pushes = 0;
+	size_t pops = 0;
+	size_t inserts = 0;
+	size_t erases = 0;
+	size_t sorts = 0;
+	size_t comparisons = 0;
+
+	// A flat JSON object with one member per counter, named as above.
+	std::string to_json() const;
+};
+
+// Allocator forwarding to Base while keeping a ListStats. Copies and rebinds share
+// the counters, so a List<T, StatsAllocator<T>> accounts for its nodes and its
+// operations in one place, read through get_allocator().stats(). A copied list
+// gets counters of its own. Lists with other allocators report nothing and pay
+// nothing for it.
+//
+// Allocators with different counters compare unequal, so nodes never move between
+// two sets of counters: splice and merge between such lists move the elements.
+// Not thread-safe, like the lists using it.
+template <typename T, typename Base = std::allocator<T>>
+class StatsAllocator
+{
+
+private:
+
+	std::shared_ptr<ListStats> _stats;
+	[[no_unique_address]] Base _base;
+
+	using BaseTraits = std::allocator_traits<Base>;
+
+	template <typename U, typename B>
+	friend class StatsAllocator;
+
+public:
+
+	using value_type = T;
+	using propagate_on_container_copy_assignment = std::false_type;
+	using propagate_on_container_move_assignment = std::true_type;
+	using propagate_on_container_swap = std::true_type;
+	using is_always_equal = std::false_type;
+
+	template <typename U>
+	struct rebind
+	{
+		using other = StatsAllocator<U, typename BaseTraits::template rebind_alloc<U>>;
+	};
+
+	StatsAllocator();
+	explicit StatsAllocator(const Base& base);
+	StatsAllocator(const StatsAllocator& other) = default;
+	template <typename U, typename B>
+	StatsAllocator(const StatsAllocator<U, B>& other);
+
+	// Declared so that "moving" copies: a moved-from allocator must still compare
+	// equal to the one constructed from it.
+	StatsAllocator& operator=(const StatsAllocator& other) = default;
+
+	T* allocate(size_t n);
+	void deallocate(T* ptr, size_t n);
+
+	// Called by List for every operation it performs, count elements at a time.
+	void record(ListEvent event, size_t count);
+
+	ListStats stats() const;
+	// Zeroes the event and allocation counters; the memory in use stays counted
+	// and becomes the new peak.
+	void reset_stats();
+
+	StatsAllocator select_on_container_copy_construction() const;
+
+	template <typename U, typename B>
+	bool operator==(const StatsAllocator<U, B>& other) const;
+};
+
+#pragma region ListStats
+
+inline std::string ListStats::to_json() const
+{
+	std::string json = "{";
+	auto add = [&json](const char* name, size_t value)
+	{
+		if (json.size() > 1)
+			json += ", ";
+		json += '"';
+		json += name;
+		json += "\": ";
+		json += std::to_string(value);
+	};
+
+	add("live_nodes", live_nodes);
+	add("bytes_in_use", bytes_in_use);
+	add("peak_bytes", peak_bytes);
+	add("allocations", allocations);
+	add("deallocations", deallocations);
+	add("pushes", pushes);
+	add("pops", pops);
+	add("inserts", inserts);
+	add("erases", erases);
+	add("sorts", sorts);
+	add("comparisons", comparisons);
+
+	return json + "}";
+}
+
+#pragma endregion
+
+#pragma region StatsAllocator
+
+template<typename T, typename Base>
+StatsAllocator<T, Base>::StatsAllocator() : StatsAllocator(Base()) { }
+
+template<typename T, typename Base>
+StatsAllocator<T, Base>::StatsAllocator(const Base& base) : _stats(std::make_shared<ListStats>()), _base(base) { }
+
+template<typename T, typename Base>
+template<typename U, typename B>
+StatsAllocator<T, Base>::StatsAllocator(const StatsAllocator<U, B>& other) : _stats(other._stats), _base(other._base) { }
+
+template<typename T, typename Base>
+T* StatsAllocator<T, Base>::allocate(size_t n)
+{
+	T* ptr = BaseTraits::allocate(_base, n);
+
+	_stats->live_nodes += n;
+	_stats->bytes_in_use += n * sizeof(T);
+	_stats->peak_bytes = std::max(_stats->peak_bytes, _stats->bytes_in_use);
+	++_stats->allocations;
+
+	return ptr;
+}
+
+template<typename T, typename Base>
+void StatsAllocator<T, Base>::deallocate(T* ptr, size_t n)
+{
+	BaseTraits::deallocate(_base, ptr, n);
+
+	_stats->live_nodes -= n;
+	_stats->bytes_in_use -= n * sizeof(T);
+	++_stats->deallocations;
+}
+
+template<typename T, typename Base>
+void StatsAllocator<T, Base>::record(ListEvent event, size_t count)
+{
+	switch (event)
+	{
+	case ListEvent::push: _stats->pushes += count; break;
+	case ListEvent::pop: _stats->pops += count; break;
+	case ListEvent::insert: _stats->inserts += count; break;
+	case ListEvent::erase: _stats->erases += count; break;
+	case ListEvent::sort: _stats->sorts += count; break;
+	case ListEvent::comparison: _stats->comparisons += count; break;
+	}
+}
+
+template<typename T, typename Base>
+ListStats StatsAllocator<T, Base>::stats() const
+{
+	return *_stats;
+}
+
+template<typename T, typename Base>
+void StatsAllocator<T, Base>::reset_stats()
+{
+	ListStats fresh;
+	fresh.live_nodes = _stats->live_nodes;
+	fresh.bytes_in_use = _stats->bytes_in_use;
+	fresh.peak_bytes = _stats->bytes_in_use;
+	*_stats = fresh;
+}
+
+template<typename T, typename Base>
+StatsAllocator<T, Base> StatsAllocator<T, Base>::select_on_container_copy_construction() const
+{
+	return StatsAllocator(BaseTraits::select_on_container_copy_construction(_base));
+}
+
+template<typename T, typename Base>
+template<typename U, typename B>
+bool StatsAllocator<T, Base>::operator==(const StatsAllocator<U, B>& other) const
+{
+	return _stats == other._stats;
+}
+
+#pragma endregion
@@ -1,6 +1,7 @@
 #pragma once
 #include "../List.h"
 #include "Fixtures/CustomAsserts.h"
+#include <utility>
 
 namespace test
 {
@@ -20,6 +21,24 @@ namespace test
 
       lst2_copy.merge(lst1_copy);
       assertBool(lst2_copy == expected_lst, __LINE__, __FILE__);
+      assertBool(lst1_copy.empty(), __LINE__, __FILE__);
+
+      // Nodes are relinked, not copied: element addresses survive the merge.
+      List<int> lst3{1, 5, 9};
+      List<int> lst4{2, 3, 10, 11};
+      const int* three = &*(++lst4.begin());
+      lst3.merge(std::move(lst4));
+      assertEqual(lst3.size(), 7, __LINE__, __FILE__);
+      assertEqual(lst4.size(), 0, __LINE__, __FILE__);
+      assertBool(&*(++(++lst3.begin())) == three, __LINE__, __FILE__);
+      assertEqual(lst3.back(), 11, __LINE__, __FILE__);
+
+      List<std::pair<int, char>> lst5{{3, 'a'}, {2, 'a'}, {1, 'a'}};
+      List<std::pair<int, char>> lst6{{3, 'b'}, {1, 'b'}};
+      auto byKeyDescending = [](const auto& lhs, const auto& rhs){ return lhs.first > rhs.first; };
+      lst5.merge(lst6, byKeyDescending);
+      List<std::pair<int, char>> expected_pairs{{3, 'a'}, {3, 'b'}, {2, 'a'}, {1, 'a'}, {1, 'b'}};
+      assertBool(lst5 == expected_pairs, __LINE__, __FILE__);
       
     }
   };
@@ -1,6 +1,7 @@
 #pragma once
 #include "../List.h"
 #include "Fixtures/CustomAsserts.h"
+#include <utility>
 
 namespace test
 {
@@ -16,6 +17,30 @@ namespace test
       int value = 0;
       for(int x: lst)
         assertEqual(x, ++value, __LINE__, __FILE__);
+
+      lst.sort([](int lhs, int rhs){ return lhs > rhs; });
+      for(int x: lst)
+        assertEqual(x, value--, __LINE__, __FILE__);
+
+      List<int> empty_lst;
+      empty_lst.sort();
+      assertBool(empty_lst.empty(), __LINE__, __FILE__);
+
+      // Elements with equal keys keep their relative order.
+      List<std::pair<int, int>> pairs;
+      for(int i = 0; i < 100; ++i)
+        pairs.push_back({(i * 7) % 5, i});
+      pairs.sort([](const auto& lhs, const auto& rhs){ return lhs.first < rhs.first; });
+
+      auto prev = pairs.begin();
+      for(auto it = ++pairs.begin(); it != pairs.end(); ++it, ++prev)
+      {
+        assertBool(prev->first <= it->first, __LINE__, __FILE__);
+        if(prev->first == it->first)
+          assertLess(prev->second, it->second, __LINE__, __FILE__);
+      }
+      assertEqual(pairs.size(), 100, __LINE__, __FILE__);
+      assertEqual(pairs.back().first, 4, __LINE__, __FILE__);
     }
   };
 
@@ -0,0 +1,112 @@
+#pragma once
+#include "../List.h"
+#include "Fixtures/CustomAsserts.h"
+#include <memory_resource>
+
+namespace test
+{
+  template <typename T>
+  struct CountingAllocator
+  {
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    std::size_t* allocationCounterPtr;
+
+    CountingAllocator(std::size_t* allocationCounterPtr)
+      : allocationCounterPtr(allocationCounterPtr)
+    {
+    }
+
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U>& other)
+      : allocationCounterPtr(other.allocationCounterPtr)
+    {
+    }
+
+    T* allocate(std::size_t n)
+    {
+      ++(*allocationCounterPtr);
+      return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* ptr, std::size_t n)
+    {
+      --(*allocationCounterPtr);
+      std::allocator<T>().deallocate(ptr, n);
+    }
+
+    template <typename U>
+    bool operator==(const CountingAllocator<U>& other) const
+    {
+      return allocationCounterPtr == other.allocationCounterPtr;
+    }
+  };
+
+  // Counts the bytes it has handed out and not yet taken back.
+  struct CountingResource : std::pmr::memory_resource
+  {
+    std::size_t live = 0;
+
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+      live += bytes;
+      return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override
+    {
+      live -= bytes;
+      std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+      return this == &other;
+    }
+  };
+
+  struct AllocatorTest
+  {
+    AllocatorTest()
+    {
+      std::size_t liveAllocations1 = 0;
+      std::size_t liveAllocations2 = 0;
+      {
+        // One allocation per element; the sentinel lives inside the list.
+        List<int, CountingAllocator<int>> lst1({1, 2, 3}, CountingAllocator<int>(&liveAllocations1));
+        assertEqual(liveAllocations1, 3, __LINE__, __FILE__);
+
+        List<int, CountingAllocator<int>> lst2{CountingAllocator<int>(&liveAllocations2)};
+        lst2.push_back(7);
+        assertEqual(liveAllocations2, 1, __LINE__, __FILE__);
+
+        // propagate_on_container_copy_assignment moves lst2 over to lst1's allocator.
+        lst2 = lst1;
+        assertBool(lst1 == lst2, __LINE__, __FILE__);
+        assertEqual(liveAllocations1, 6, __LINE__, __FILE__);
+        assertEqual(liveAllocations2, 0, __LINE__, __FILE__);
+
+        lst2.swap(lst1);
+        assertBool(lst2.get_allocator() == CountingAllocator<int>(&liveAllocations1), __LINE__, __FILE__);
+      }
+      assertEqual(liveAllocations1, 0, __LINE__, __FILE__);
+
+      std::byte buffer[1024];
+      std::pmr::monotonic_buffer_resource resource(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+      pmr::List<int> lst3(&resource);
+      for(int i = 0; i < 10; ++i)
+        lst3.push_back(i);
+      assertEqual(lst3.size(), 10, __LINE__, __FILE__);
+      assertEqual(lst3.back(), 9, __LINE__, __FILE__);
+      assertBool(lst3.get_allocator().resource() == &resource, __LINE__, __FILE__);
+
+      pmr::List<int> lst4(lst3);
+      assertBool(lst4 == lst3, __LINE__, __FILE__);
+      assertBool(lst4.get_allocator().resource() == std::pmr::get_default_resource(), __LINE__, __FILE__);
+    }
+  };
+
+  static AllocatorTest allocatorTest;
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include "../List.h"
+#include "../PoolAllocator.h"
+#include "Fixtures/CustomAsserts.h"
+
+namespace test
+{
+  struct PoolAllocatorTest
+  {
+    PoolAllocatorTest()
+    {
+      List<int, PoolAllocator<int, 8>> lst;
+      assertEqual(lst.get_allocator().slab_count(), 0, __LINE__, __FILE__);
+      lst.push_back(0);
+      assertEqual(lst.get_allocator().slab_count(), 1, __LINE__, __FILE__);
+
+      lst.reserve_nodes(20);
+      auto slabs = lst.get_allocator().slab_count();
+      for(int i = 1; i < 20; ++i)
+        lst.push_back(i);
+      assertEqual(lst.get_allocator().slab_count(), slabs, __LINE__, __FILE__);
+
+      // Steady-state churn recycles popped nodes instead of growing the pool.
+      for(int i = 20; i < 1000; ++i)
+      {
+        lst.pop_front();
+        lst.push_back(i);
+      }
+      assertEqual(lst.size(), 20, __LINE__, __FILE__);
+      assertEqual(lst.front(), 980, __LINE__, __FILE__);
+      assertEqual(lst.back(), 999, __LINE__, __FILE__);
+      assertEqual(lst.get_allocator().slab_count(), slabs, __LINE__, __FILE__);
+
+      lst.clear();
+      lst.shrink_to_fit();
+      assertEqual(lst.get_allocator().slab_count(), 0, __LINE__, __FILE__);
+
+      lst.push_back(1);
+      List<int, PoolAllocator<int, 8>> copy(lst);
+      assertBool(copy == lst, __LINE__, __FILE__);
+      assertBool(copy.get_allocator() != lst.get_allocator(), __LINE__, __FILE__);
+
+      // Lists without a pool accept the calls and ignore them.
+      List<int> plain{1, 2, 3};
+      plain.reserve_nodes(100);
+      plain.shrink_to_fit();
+      assertEqual(plain.size(), 3, __LINE__, __FILE__);
+    }
+  };
+
+  static PoolAllocatorTest poolAllocatorTest;
+}
@@ -0,0 +1,55 @@
+#pragma once
+#include "../List.h"
+#include "Fixtures/CustomAsserts.h"
+
+namespace test
+{
+  struct SpliceTest
+  {
+    SpliceTest()
+    {
+      List<int> lst1{1, 2, 3};
+      List<int> lst2{10, 20, 30, 40};
+      const int* twenty = &*(++lst2.begin());
+
+      // Single element: 20 moves in front of 2 without being copied.
+      lst1.splice(++lst1.begin(), lst2, ++lst2.begin());
+      List<int> expected_lst1{1, 20, 2, 3};
+      List<int> expected_lst2{10, 30, 40};
+      assertBool(lst1 == expected_lst1, __LINE__, __FILE__);
+      assertBool(lst2 == expected_lst2, __LINE__, __FILE__);
+      assertEqual(lst1.size(), 4, __LINE__, __FILE__);
+      assertEqual(lst2.size(), 3, __LINE__, __FILE__);
+      assertBool(&*(++lst1.begin()) == twenty, __LINE__, __FILE__);
+
+      // Range [30, end) to the back.
+      lst1.splice(lst1.end(), lst2, ++lst2.begin(), lst2.end());
+      List<int> expected_lst3{1, 20, 2, 3, 30, 40};
+      assertBool(lst1 == expected_lst3, __LINE__, __FILE__);
+      assertEqual(lst1.size(), 6, __LINE__, __FILE__);
+      assertEqual(lst2.size(), 1, __LINE__, __FILE__);
+
+      // Whole list to the front.
+      lst1.splice(lst1.begin(), lst2);
+      List<int> expected_lst4{10, 1, 20, 2, 3, 30, 40};
+      assertBool(lst1 == expected_lst4, __LINE__, __FILE__);
+      assertBool(lst2.empty(), __LINE__, __FILE__);
+      assertEqual(lst1.size(), 7, __LINE__, __FILE__);
+
+      // Within the same list: move the last element to the front, LRU style.
+      lst1.splice(lst1.begin(), lst1, --lst1.end());
+      List<int> expected_lst5{40, 10, 1, 20, 2, 3, 30};
+      assertBool(lst1 == expected_lst5, __LINE__, __FILE__);
+      assertEqual(lst1.size(), 7, __LINE__, __FILE__);
+
+      lst1.splice(lst1.begin(), lst1, lst1.begin());
+      assertBool(lst1 == expected_lst5, __LINE__, __FILE__);
+
+      lst2.splice(lst2.end(), std::move(lst1));
+      assertBool(lst2 == expected_lst5, __LINE__, __FILE__);
+      assertBool(lst1.empty(), __LINE__, __FILE__);
+    }
+  };
+
+  static SpliceTest spliceTest;
+}
@@ -0,0 +1,94 @@
+#pragma once
+#include "../List.h"
+#include "Fixtures/CustomAsserts.h"
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace test
+{
+  struct TestClassForMove
+  {
+    std::size_t* copyCounterPtr;
+    std::size_t* moveCounterPtr;
+
+    TestClassForMove(std::size_t* copyCounterPtr, std::size_t* moveCounterPtr)
+      : copyCounterPtr(copyCounterPtr)
+      , moveCounterPtr(moveCounterPtr)
+    {
+    }
+
+    TestClassForMove(const TestClassForMove& other)
+      : copyCounterPtr(other.copyCounterPtr)
+      , moveCounterPtr(other.moveCounterPtr)
+    {
+      ++(*copyCounterPtr);
+    }
+
+    TestClassForMove(TestClassForMove&& other)
+      : copyCounterPtr(other.copyCounterPtr)
+      , moveCounterPtr(other.moveCounterPtr)
+    {
+      ++(*moveCounterPtr);
+    }
+  };
+
+  inline List<std::string> makeStrings()
+  {
+    List<std::string> lst{"a", "b", "c"};
+    return lst;
+  }
+
+  struct MoveSemanticsTest
+  {
+    MoveSemanticsTest()
+    {
+      assertBool(std::is_nothrow_default_constructible<List<int>>(), __LINE__, __FILE__);
+      assertBool(std::is_nothrow_move_constructible<List<int>>(), __LINE__, __FILE__);
+      assertBool(std::is_nothrow_move_assignable<List<int>>(), __LINE__, __FILE__);
+
+      List<std::string> lst1 = makeStrings();
+      assertEqual(lst1.size(), 3, __LINE__, __FILE__);
+
+      const std::string* first = &lst1.front();
+      List<std::string> lst2(std::move(lst1));
+      assertBool(lst1.empty(), __LINE__, __FILE__);
+      assertEqual(lst2.size(), 3, __LINE__, __FILE__);
+      assertBool(&lst2.front() == first, __LINE__, __FILE__);
+
+      lst1.push_back("x");
+      lst1 = std::move(lst2);
+      assertEqual(lst1.size(), 3, __LINE__, __FILE__);
+      assertBool(&lst1.front() == first, __LINE__, __FILE__);
+      assertEqual(lst1.back(), std::string("c"), __LINE__, __FILE__);
+
+      lst2.push_back("y");
+      swap(lst1, lst2);
+      assertEqual(lst1.size(), 1, __LINE__, __FILE__);
+      assertEqual(lst2.size(), 3, __LINE__, __FILE__);
+      assertEqual(*(--lst2.end()), std::string("c"), __LINE__, __FILE__);
+      assertEqual(*lst1.rbegin(), std::string("y"), __LINE__, __FILE__);
+
+      List<std::string> empty_lst;
+      swap(lst1, empty_lst);
+      assertBool(lst1.empty() && lst1.begin() == lst1.end(), __LINE__, __FILE__);
+      assertEqual(empty_lst.front(), std::string("y"), __LINE__, __FILE__);
+
+      std::size_t copies = 0;
+      std::size_t moves = 0;
+      List<TestClassForMove> lst3;
+      lst3.push_back(TestClassForMove(&copies, &moves));
+      lst3.push_front(TestClassForMove(&copies, &moves));
+      lst3.insert(lst3.begin(), TestClassForMove(&copies, &moves));
+      assertEqual(copies, 0, __LINE__, __FILE__);
+      assertEqual(moves, 3, __LINE__, __FILE__);
+
+      TestClassForMove obj(&copies, &moves);
+      lst3.push_back(obj);
+      assertEqual(copies, 1, __LINE__, __FILE__);
+      assertEqual(moves, 3, __LINE__, __FILE__);
+    }
+  };
+
+  static MoveSemanticsTest moveSemanticsTest;
+}
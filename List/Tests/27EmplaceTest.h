@@ -0,0 +1,51 @@
+#pragma once
+#include "../List.h"
+#include "Fixtures/CustomAsserts.h"
+#include <string>
+
+namespace test
+{
+  struct TestClassNonMovable
+  {
+    int id;
+    std::string name;
+
+    TestClassNonMovable(int id, const char* name)
+      : id(id)
+      , name(name)
+    {
+    }
+
+    TestClassNonMovable(const TestClassNonMovable&) = delete;
+    TestClassNonMovable& operator=(const TestClassNonMovable&) = delete;
+  };
+
+  struct EmplaceTest
+  {
+    EmplaceTest()
+    {
+      List<TestClassNonMovable> lst;
+      TestClassNonMovable& second = lst.emplace_back(2, "two");
+      assertEqual(second.id, 2, __LINE__, __FILE__);
+
+      lst.emplace_front(1, "one");
+      lst.emplace_back(4, "four");
+      auto it = lst.emplace(--lst.end(), 3, "three");
+      assertEqual(it->id, 3, __LINE__, __FILE__);
+      assertEqual(it->name, std::string("three"), __LINE__, __FILE__);
+      assertEqual(lst.size(), 4, __LINE__, __FILE__);
+
+      int expected = 0;
+      for(const auto& item : lst)
+        assertEqual(item.id, ++expected, __LINE__, __FILE__);
+
+      assertBool(&lst.front() != &second && &*(++lst.begin()) == &second, __LINE__, __FILE__);
+
+      List<std::string> strings;
+      strings.emplace_back(3, 'x');
+      assertEqual(strings.front(), std::string("xxx"), __LINE__, __FILE__);
+    }
+  };
+
+  static EmplaceTest emplaceTest;
+}
@@ -0,0 +1,97 @@
+#pragma once
+#include "../List.h"
+#include "Fixtures/CustomAsserts.h"
+#include <stdexcept>
+#include <vector>
+
+namespace test
+{
+  struct TestClassThrowingCopy
+  {
+    int value;
+
+    TestClassThrowingCopy(int value)
+      : value(value)
+    {
+    }
+
+    TestClassThrowingCopy(const TestClassThrowingCopy& other)
+      : value(other.value)
+    {
+      if(value < 0)
+        throw std::runtime_error("negative");
+    }
+  };
+
+  struct BulkInsertTest
+  {
+    BulkInsertTest()
+    {
+      List<int> lst{1, 5};
+      std::vector<int> vec{2, 3, 4};
+
+      auto it = lst.insert(++lst.begin(), vec.begin(), vec.end());
+      assertEqual(*it, 2, __LINE__, __FILE__);
+      assertBool(lst == List<int>{1, 2, 3, 4, 5}, __LINE__, __FILE__);
+      assertEqual(lst.size(), 5, __LINE__, __FILE__);
+
+      it = lst.insert(lst.end(), 2, 6);
+      assertEqual(*it, 6, __LINE__, __FILE__);
+      lst.insert(lst.begin(), {-1, 0});
+      assertBool(lst == List<int>{-1, 0, 1, 2, 3, 4, 5, 6, 6}, __LINE__, __FILE__);
+
+      it = lst.insert(lst.begin(), vec.end(), vec.end());
+      assertBool(it == lst.begin(), __LINE__, __FILE__);
+
+      List<int> lst2;
+      lst2.append_range(vec);
+      lst2.prepend_range(List<int>{0, 1});
+      lst2.insert_range(lst2.end(), std::vector<int>{5});
+      assertBool(lst2 == List<int>{0, 1, 2, 3, 4, 5}, __LINE__, __FILE__);
+      assertEqual(lst2.size(), 6, __LINE__, __FILE__);
+
+      lst2.assign(3, 7);
+      assertBool(lst2 == List<int>{7, 7, 7}, __LINE__, __FILE__);
+      lst2.assign(vec.begin(), vec.end());
+      assertBool(lst2 == List<int>{2, 3, 4}, __LINE__, __FILE__);
+      lst2.assign({9});
+      assertBool(lst2 == List<int>{9}, __LINE__, __FILE__);
+      lst2.assign_range(vec);
+      assertEqual(lst2.size(), 3, __LINE__, __FILE__);
+
+      // Strong guarantee: a throwing element copy leaves the list untouched.
+      List<TestClassThrowingCopy> lst3;
+      lst3.emplace_back(1);
+      std::vector<TestClassThrowingCopy> bad;
+      bad.reserve(3);
+      for(int value : {2, 3, -4})
+        bad.emplace_back(value);
+      bool thrown = false;
+      try
+      {
+        lst3.insert(lst3.end(), bad.begin(), bad.end());
+      }
+      catch(const std::runtime_error&)
+      {
+        thrown = true;
+      }
+      assertBool(thrown, __LINE__, __FILE__);
+      assertEqual(lst3.size(), 1, __LINE__, __FILE__);
+      assertEqual(lst3.back().value, 1, __LINE__, __FILE__);
+
+      thrown = false;
+      try
+      {
+        lst3.assign(bad.begin(), bad.end());
+      }
+      catch(const std::runtime_error&)
+      {
+        thrown = true;
+      }
+      assertBool(thrown, __LINE__, __FILE__);
+      assertEqual(lst3.size(), 1, __LINE__, __FILE__);
+    }
+  };
+
+  static BulkInsertTest bulkInsertTest;
+}
@@ -0,0 +1,237 @@
+#pragma once
+#include "../UnrolledList.h"
+#include "../List.h"
+#include "23AllocatorTest.h"
+#include "Fixtures/CustomAsserts.h"
+#include <string>
+#include <vector>
+
+namespace test
+{
+  // Its move may throw, so the list has to copy it; the copy throws once
+  // copiesLeft reaches zero. live counts the instances in existence.
+  struct TestClassThrowingMove
+  {
+    int value;
+    static inline int copiesLeft = -1;
+    static inline int live = 0;
+
+    TestClassThrowingMove(int value)
+      : value(value)
+    {
+      ++live;
+    }
+
+    TestClassThrowingMove(const TestClassThrowingMove& other)
+      : value(other.value)
+    {
+      if(copiesLeft == 0)
+        throw 0;
+      if(copiesLeft > 0)
+        --copiesLeft;
+      ++live;
+    }
+
+    TestClassThrowingMove(TestClassThrowingMove&& other) noexcept(false)
+      : TestClassThrowingMove(static_cast<const TestClassThrowingMove&>(other))
+    {
+    }
+
+    ~TestClassThrowingMove()
+    {
+      --live;
+    }
+  };
+
+  struct UnrolledListTest
+  {
+    UnrolledListTest()
+    {
+      UnrolledList<int, 4> lst;
+      assertBool(lst.empty(), __LINE__, __FILE__);
+      assertBool(lst.begin() == lst.end(), __LINE__, __FILE__);
+
+      for(int i = 0; i < 10; ++i)
+        lst.push_back(i);
+      assertEqual(lst.size(), 10, __LINE__, __FILE__);
+      assertEqual(lst.front(), 0, __LINE__, __FILE__);
+      assertEqual(lst.back(), 9, __LINE__, __FILE__);
+
+      // Inserting into a full block splits it.
+      auto it = lst.begin();
+      ++it;
+      it = lst.insert(it, 100);
+      assertEqual(*it, 100, __LINE__, __FILE__);
+      assertEqual(*++it, 1, __LINE__, __FILE__);
+      assertBool(lst == UnrolledList<int, 4>{0, 100, 1, 2, 3, 4, 5, 6, 7, 8, 9}, __LINE__, __FILE__);
+
+      lst.push_front(-1);
+      lst.insert(lst.end(), 10);
+      assertEqual(lst.front(), -1, __LINE__, __FILE__);
+      assertEqual(lst.back(), 10, __LINE__, __FILE__);
+
+      int expected = 10;
+      for(auto rit = lst.rbegin(); rit != lst.rend() && expected >= 1; ++rit, --expected)
+        assertEqual(*rit, expected, __LINE__, __FILE__);
+
+      // Erasing returns the following element, including across blocks.
+      it = lst.begin();
+      while(it != lst.end())
+      {
+        if(*it % 2 == 0)
+          it = lst.erase(it);
+        else
+          ++it;
+      }
+      assertBool(lst == UnrolledList<int, 4>{-1, 1, 3, 5, 7, 9}, __LINE__, __FILE__);
+
+      lst.pop_front();
+      lst.pop_back();
+      assertBool(lst == UnrolledList<int, 4>{1, 3, 5, 7}, __LINE__, __FILE__);
+
+      UnrolledList<int, 4> copy(lst);
+      assertBool(copy == lst, __LINE__, __FILE__);
+      UnrolledList<int, 4> moved(std::move(copy));
+      assertBool(moved == lst, __LINE__, __FILE__);
+      assertBool(copy.empty(), __LINE__, __FILE__);
+
+      copy = moved;
+      moved = UnrolledList<int, 4>{42};
+      assertBool(copy == lst, __LINE__, __FILE__);
+      assertEqual(moved.front(), 42, __LINE__, __FILE__);
+
+      swap(copy, moved);
+      assertEqual(copy.size(), 1, __LINE__, __FILE__);
+      assertEqual(moved.size(), 4, __LINE__, __FILE__);
+
+      while(!moved.empty())
+        moved.pop_front();
+      assertBool(moved.begin() == moved.end(), __LINE__, __FILE__);
+
+      // Same results as List under a mixed workload on non-trivial elements.
+      UnrolledList<std::string, 8> strings;
+      List<std::string> reference;
+      for(int i = 0; i < 200; ++i)
+      {
+        auto pos = strings.begin();
+        auto refPos = reference.begin();
+        for(int step = 0; step < i % 7 && pos != strings.end(); ++step, ++pos, ++refPos);
+        if(i % 3 == 2 && pos != strings.end())
+        {
+          strings.erase(pos);
+          reference.erase(refPos);
+        }
+        else
+        {
+          strings.insert(pos, std::to_string(i));
+          reference.insert(refPos, std::to_string(i));
+        }
+      }
+      assertEqual(strings.size(), reference.size(), __LINE__, __FILE__);
+      auto refIt = reference.cbegin();
+      for(const std::string& val : strings)
+        assertBool(val == *refIt++, __LINE__, __FILE__);
+
+      // A copy that throws partway through a split, a shift or a merge leaves the
+      // list as it was, with no element destroyed twice or leaked.
+      {
+        using ThrowingList = UnrolledList<TestClassThrowingMove, 4>;
+        auto values = [](const ThrowingList& lst){
+          std::vector<int> result;
+          for(const TestClassThrowingMove& val : lst)
+            result.push_back(val.value);
+          return result;
+        };
+
+        ThrowingList lst;
+        for(int i = 0; i < 10; ++i)
+          lst.emplace_back(i);
+        const std::vector<int> expected = values(lst);
+
+        for(int copies = 0; copies < 3; ++copies)
+        {
+          TestClassThrowingMove::copiesLeft = copies;
+          try
+          {
+            lst.insert(std::next(lst.begin()), TestClassThrowingMove(100));
+            assertBool(false, __LINE__, __FILE__);
+          }
+          catch(int)
+          {
+          }
+          assertBool(values(lst) == expected, __LINE__, __FILE__);
+          assertEqual(TestClassThrowingMove::live, 10, __LINE__, __FILE__);
+
+          TestClassThrowingMove::copiesLeft = copies;
+          try
+          {
+            lst.erase(std::next(lst.begin(), 5));
+            assertBool(false, __LINE__, __FILE__);
+          }
+          catch(int)
+          {
+          }
+          assertBool(values(lst) == expected, __LINE__, __FILE__);
+          assertEqual(TestClassThrowingMove::live, 10, __LINE__, __FILE__);
+        }
+
+        TestClassThrowingMove::copiesLeft = -1;
+        lst.insert(std::next(lst.begin()), TestClassThrowingMove(100));
+        auto it = lst.erase(std::next(lst.begin(), 2));
+        assertEqual(it->value, 2, __LINE__, __FILE__);
+        assertEqual(lst.size(), 10, __LINE__, __FILE__);
+        assertEqual(TestClassThrowingMove::live, 10, __LINE__, __FILE__);
+
+        // Erasing from the back of a block needs no copies; once the block is below a
+        // quarter full it is merged with the next one, unless a copy throws.
+        UnrolledList<TestClassThrowingMove, 8> sparse;
+        for(int i = 0; i < 10; ++i)
+          sparse.emplace_back(i);
+        for(int i = 7; i > 1; --i)
+          sparse.erase(std::next(sparse.begin(), i));
+        TestClassThrowingMove::copiesLeft = 0;
+        auto next = sparse.erase(std::next(sparse.begin()));
+        TestClassThrowingMove::copiesLeft = -1;
+        assertEqual(next->value, 8, __LINE__, __FILE__);
+        assertEqual(sparse.size(), 3, __LINE__, __FILE__);
+        assertEqual(sparse.back().value, 9, __LINE__, __FILE__);
+        assertEqual(TestClassThrowingMove::live, 13, __LINE__, __FILE__);
+      }
+      assertEqual(TestClassThrowingMove::live, 0, __LINE__, __FILE__);
+
+      // With unequal allocators that do not propagate, swap exchanges values and
+      // moves the surplus, so every block is freed by the allocator that made it.
+      {
+        CountingResource lhsResource;
+        CountingResource rhsResource;
+        {
+          using PmrList = UnrolledList<int, 4, std::pmr::polymorphic_allocator<int>>;
+          PmrList lhs({1, 2}, &lhsResource);
+          PmrList rhs({3, 4, 5, 6, 7, 8, 9}, &rhsResource);
+
+          swap(lhs, rhs);
+          assertBool(lhs == PmrList{3, 4, 5, 6, 7, 8, 9}, __LINE__, __FILE__);
+          assertBool(rhs == PmrList{1, 2}, __LINE__, __FILE__);
+          assertBool(lhs.get_allocator().resource() == &lhsResource, __LINE__, __FILE__);
+          assertGreater(lhsResource.live, rhsResource.live, __LINE__, __FILE__);
+
+          swap(lhs, rhs);
+          assertBool(lhs == PmrList{1, 2}, __LINE__, __FILE__);
+          assertBool(rhs == PmrList{3, 4, 5, 6, 7, 8, 9}, __LINE__, __FILE__);
+          lhs.push_back(10);
+          rhs.push_front(0);
+          assertEqual(lhs.back(), 10, __LINE__, __FILE__);
+          assertEqual(rhs.front(), 0, __LINE__, __FILE__);
+        }
+        assertEqual(lhsResource.live, 0, __LINE__, __FILE__);
+        assertEqual(rhsResource.live, 0, __LINE__, __FILE__);
+      }
+
+      const UnrolledList<int> constLst{1, 2, 3};
+      assertEqual(std::distance(constLst.cbegin(), constLst.cend()), 3, __LINE__, __FILE__);
+      assertEqual(*constLst.crbegin(), 3, __LINE__, __FILE__);
+    }
+  };
+
+  static UnrolledListTest unrolledListTest;
+}
@@ -0,0 +1,130 @@
+#pragma once
+#include "../ArenaList.h"
+#include "23AllocatorTest.h"
+#include "Fixtures/CustomAsserts.h"
+#include <string>
+
+namespace test
+{
+  struct ArenaListTest
+  {
+    ArenaListTest()
+    {
+      ArenaList<int> lst{1, 2, 3};
+      assertEqual(lst.size(), 3, __LINE__, __FILE__);
+      assertEqual(lst.front(), 1, __LINE__, __FILE__);
+      assertEqual(lst.back(), 3, __LINE__, __FILE__);
+
+      auto h4 = lst.emplace_back(4);
+      auto h0 = lst.emplace_front(0);
+      assertBool(lst == ArenaList<int>{0, 1, 2, 3, 4}, __LINE__, __FILE__);
+      assertEqual(*lst.get(h4), 4, __LINE__, __FILE__);
+      assertBool(lst.find(h0) == lst.begin(), __LINE__, __FILE__);
+
+      // Iterators and handles survive the array growing.
+      auto it = ++lst.begin();
+      for(int i = 5; i < 100; ++i)
+        lst.push_back(i);
+      assertEqual(*it, 1, __LINE__, __FILE__);
+      assertEqual(*lst.get(h4), 4, __LINE__, __FILE__);
+
+      // Erase through a handle; the handle and its reused slot are told apart.
+      assertBool(lst.erase(h4), __LINE__, __FILE__);
+      assertBool(!lst.contains(h4), __LINE__, __FILE__);
+      assertBool(lst.get(h4) == nullptr, __LINE__, __FILE__);
+      assertBool(!lst.erase(h4), __LINE__, __FILE__);
+      size_t capacity = lst.capacity();
+      auto reused = lst.emplace_back(-1);
+      assertBool(!(reused == h4), __LINE__, __FILE__);
+      assertBool(!lst.contains(h4), __LINE__, __FILE__);
+      assertEqual(lst.capacity(), capacity, __LINE__, __FILE__);
+      assertEqual(lst.size(), 100, __LINE__, __FILE__);
+
+      it = lst.insert(it, 42);
+      assertEqual(*it, 42, __LINE__, __FILE__);
+      it = lst.erase(it);
+      assertEqual(*it, 1, __LINE__, __FILE__);
+      assertEqual(*lst.rbegin(), -1, __LINE__, __FILE__);
+      assertEqual(*--lst.end(), -1, __LINE__, __FILE__);
+
+      auto handle = lst.handle_of(it);
+      lst.clear();
+      assertBool(lst.empty(), __LINE__, __FILE__);
+      assertBool(!lst.contains(handle), __LINE__, __FILE__);
+      assertBool(!lst.contains(ArenaList<int>::handle()), __LINE__, __FILE__);
+
+      lst.push_back(7);
+      lst.pop_back();
+      lst.pop_front();
+      assertBool(lst.begin() == lst.end(), __LINE__, __FILE__);
+
+      // Non-trivial elements across growth, copy and move.
+      ArenaList<std::string> strings;
+      for(int i = 0; i < 20; ++i)
+        strings.push_back(std::to_string(i));
+      strings.push_front(strings.back());
+      assertBool(strings.front() == "19", __LINE__, __FILE__);
+
+      ArenaList<std::string> copy(strings);
+      assertBool(copy == strings, __LINE__, __FILE__);
+      ArenaList<std::string> moved(std::move(copy));
+      assertBool(moved == strings, __LINE__, __FILE__);
+      assertBool(copy.empty(), __LINE__, __FILE__);
+
+      copy = moved;
+      moved = ArenaList<std::string>{"a"};
+      assertBool(copy == strings, __LINE__, __FILE__);
+      assertEqual(moved.size(), 1, __LINE__, __FILE__);
+      auto first = copy.handle_of(copy.begin());
+      swap(copy, moved);
+      assertBool(moved == strings, __LINE__, __FILE__);
+      assertBool(*moved.get(first) == "19", __LINE__, __FILE__);
+
+      // Copy assignment onto an unequal, propagating allocator replaces the array,
+      // and handles into the old array stay stale in the new one.
+      {
+        std::size_t lhsCount = 0;
+        std::size_t rhsCount = 0;
+        using CountingArena = ArenaList<int, CountingAllocator<int>>;
+        CountingArena lhs({1, 2, 3}, CountingAllocator<int>(&lhsCount));
+        CountingArena rhs({4, 5, 6}, CountingAllocator<int>(&rhsCount));
+        auto stale = lhs.handle_of(lhs.begin());
+        lhs = rhs;
+        assertEqual(lhsCount, 0, __LINE__, __FILE__);
+        assertBool(lhs == rhs, __LINE__, __FILE__);
+        assertBool(!lhs.contains(stale), __LINE__, __FILE__);
+        assertBool(lhs.get(stale) == nullptr, __LINE__, __FILE__);
+        assertBool(lhs.contains(lhs.handle_of(lhs.begin())), __LINE__, __FILE__);
+      }
+
+      // A list that adopts another array by move or swap does not match handles to
+      // elements it destroyed against slots of the adopted array.
+      {
+        ArenaList<int> lhs;
+        auto stale = lhs.emplace_back(1);
+        ArenaList<int> rhs;
+        auto kept = rhs.emplace_back(42);
+        lhs = std::move(rhs);
+        assertBool(!lhs.contains(stale), __LINE__, __FILE__);
+        assertBool(lhs.get(stale) == nullptr, __LINE__, __FILE__);
+        assertEqual(*lhs.get(kept), 42, __LINE__, __FILE__);
+        assertBool(!rhs.contains(stale), __LINE__, __FILE__);
+
+        ArenaList<int> other{7};
+        stale = lhs.handle_of(lhs.begin());
+        lhs.clear();
+        swap(lhs, other);
+        assertBool(!lhs.contains(stale), __LINE__, __FILE__);
+        assertBool(!other.contains(stale), __LINE__, __FILE__);
+        assertBool(lhs.find(stale) == lhs.end(), __LINE__, __FILE__);
+        assertEqual(lhs.front(), 7, __LINE__, __FILE__);
+      }
+
+      const ArenaList<int> constLst{1, 2, 3};
+      assertEqual(std::distance(constLst.cbegin(), constLst.cend()), 3, __LINE__, __FILE__);
+      assertEqual(*constLst.crbegin(), 3, __LINE__, __FILE__);
+    }
+  };
+
+  static ArenaListTest arenaListTest;
+}
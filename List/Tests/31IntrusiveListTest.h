@@ -0,0 +1,116 @@
+#pragma once
+#include "../IntrusiveList.h"
+#include "Fixtures/CustomAsserts.h"
+#include <string>
+#include <vector>
+
+namespace test
+{
+  struct IntrusiveTask
+  {
+    int id;
+    std::string name;
+    ListHook lruHook;
+    ListHook tenantHook;
+
+    IntrusiveTask(int id) : id(id), name(std::to_string(id)) { }
+  };
+
+  struct AutoUnlinkTask
+  {
+    int id;
+    AutoUnlinkListHook hook;
+
+    AutoUnlinkTask(int id) : id(id) { }
+  };
+
+  struct IntrusiveListTest
+  {
+    IntrusiveListTest()
+    {
+      std::vector<IntrusiveTask> tasks;
+      for(int i = 0; i < 5; ++i)
+        tasks.emplace_back(i);
+
+      IntrusiveList<IntrusiveTask, &IntrusiveTask::lruHook> lru;
+      IntrusiveList<IntrusiveTask, &IntrusiveTask::tenantHook> tenant;
+      assertBool(lru.empty(), __LINE__, __FILE__);
+
+      for(IntrusiveTask& task : tasks)
+        lru.push_back(task);
+      tenant.push_back(tasks[3]);
+      tenant.push_front(tasks[1]);
+
+      assertEqual(lru.size(), 5, __LINE__, __FILE__);
+      assertEqual(tenant.size(), 2, __LINE__, __FILE__);
+      assertEqual(&lru.front(), &tasks[0], __LINE__, __FILE__);
+      assertEqual(&tenant.front(), &tasks[1], __LINE__, __FILE__);
+      assertEqual(tenant.back().name, std::string("3"), __LINE__, __FILE__);
+
+      // Erasing from one list leaves the other membership alone.
+      lru.erase(tasks[3]);
+      assertBool(!tasks[3].lruHook.is_linked(), __LINE__, __FILE__);
+      assertBool(tasks[3].tenantHook.is_linked(), __LINE__, __FILE__);
+      assertEqual(lru.size(), 4, __LINE__, __FILE__);
+
+      // Move a touched element to the back, as an LRU would.
+      lru.erase(lru.iterator_to(tasks[1]));
+      lru.push_back(tasks[1]);
+      std::vector<int> order;
+      for(const IntrusiveTask& task : lru)
+        order.push_back(task.id);
+      assertBool(order == std::vector<int>{0, 2, 4, 1}, __LINE__, __FILE__);
+
+      order.clear();
+      for(auto it = lru.rbegin(); it != lru.rend(); ++it)
+        order.push_back(it->id);
+      assertBool(order == std::vector<int>{1, 4, 2, 0}, __LINE__, __FILE__);
+
+      auto it = lru.insert(++lru.begin(), tasks[3]);
+      assertEqual(it->id, 3, __LINE__, __FILE__);
+      it = lru.erase(it);
+      assertEqual(it->id, 2, __LINE__, __FILE__);
+
+      IntrusiveList<IntrusiveTask, &IntrusiveTask::lruHook> other;
+      other.push_back(tasks[3]);
+      lru.splice(lru.begin(), other);
+      assertEqual(lru.front().id, 3, __LINE__, __FILE__);
+      assertBool(other.empty(), __LINE__, __FILE__);
+      assertEqual(lru.size(), 5, __LINE__, __FILE__);
+
+      other = std::move(lru);
+      assertBool(lru.empty(), __LINE__, __FILE__);
+      assertEqual(other.size(), 5, __LINE__, __FILE__);
+      swap(lru, other);
+      assertEqual(lru.back().id, 1, __LINE__, __FILE__);
+
+      lru.pop_front();
+      lru.pop_back();
+      assertEqual(lru.size(), 3, __LINE__, __FILE__);
+      lru.clear();
+      tenant.clear();
+      for(const IntrusiveTask& task : tasks)
+        assertBool(!task.lruHook.is_linked() && !task.tenantHook.is_linked(), __LINE__, __FILE__);
+
+      // An auto-unlink hook leaves its list when its object dies.
+      IntrusiveList<AutoUnlinkTask, &AutoUnlinkTask::hook> autoList;
+      AutoUnlinkTask first(1);
+      autoList.push_back(first);
+      {
+        AutoUnlinkTask second(2);
+        autoList.push_back(second);
+        assertEqual(autoList.size(), 2, __LINE__, __FILE__);
+      }
+      assertEqual(autoList.size(), 1, __LINE__, __FILE__);
+      assertEqual(autoList.back().id, 1, __LINE__, __FILE__);
+      first.hook.unlink();
+      assertBool(autoList.empty(), __LINE__, __FILE__);
+
+      // Copying an object does not copy its membership.
+      IntrusiveTask copy(tasks[0]);
+      assertBool(!copy.lruHook.is_linked(), __LINE__, __FILE__);
+    }
+  };
+
+  static IntrusiveListTest intrusiveListTest;
+}
@@ -0,0 +1,155 @@
+#pragma once
+#include "../ForwardList.h"
+#include "23AllocatorTest.h"
+#include "Fixtures/CustomAsserts.h"
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace test
+{
+  struct ForwardListTest
+  {
+    ForwardListTest()
+    {
+      ForwardList<int> lst;
+      assertBool(lst.empty(), __LINE__, __FILE__);
+      assertBool(lst.begin() == lst.end(), __LINE__, __FILE__);
+
+      // Queue use: push_back and pop_front keep the tail right.
+      for(int i = 0; i < 5; ++i)
+        lst.push_back(i);
+      lst.pop_front();
+      lst.push_back(5);
+      assertBool(lst == ForwardList<int>{1, 2, 3, 4, 5}, __LINE__, __FILE__);
+      assertEqual(lst.front(), 1, __LINE__, __FILE__);
+      assertEqual(lst.back(), 5, __LINE__, __FILE__);
+      while(!lst.empty())
+        lst.pop_front();
+      lst.push_back(7);
+      assertEqual(lst.front(), 7, __LINE__, __FILE__);
+      assertEqual(lst.back(), 7, __LINE__, __FILE__);
+
+      lst.push_front(6);
+      auto it = lst.insert_after(lst.begin(), 10);
+      assertEqual(*it, 10, __LINE__, __FILE__);
+      it = lst.insert_after(it, 11);
+      it = lst.erase_after(lst.begin());
+      assertEqual(*it, 11, __LINE__, __FILE__);
+      assertBool(lst == ForwardList<int>{6, 11, 7}, __LINE__, __FILE__);
+
+      // Erasing the last node moves the tail back.
+      lst.erase_after(it);
+      assertEqual(lst.back(), 11, __LINE__, __FILE__);
+      lst.push_back(12);
+      assertBool(lst == ForwardList<int>{6, 11, 12}, __LINE__, __FILE__);
+
+      it = lst.erase_after(lst.before_begin(), lst.end());
+      assertBool(it == lst.end(), __LINE__, __FILE__);
+      assertBool(lst.empty(), __LINE__, __FILE__);
+      lst.push_back(1);
+      assertEqual(lst.back(), 1, __LINE__, __FILE__);
+
+      // splice_after moves nodes and keeps both tails right.
+      ForwardList<int> other{2, 3};
+      lst.splice_after(lst.begin(), other);
+      assertBool(other.empty(), __LINE__, __FILE__);
+      assertEqual(lst.back(), 3, __LINE__, __FILE__);
+      other.push_back(4);
+      assertEqual(other.front(), 4, __LINE__, __FILE__);
+      lst.splice_after(lst.before_begin(), other, other.before_begin());
+      assertBool(other.empty(), __LINE__, __FILE__);
+      other.push_back(9);
+      assertEqual(other.back(), 9, __LINE__, __FILE__);
+      assertBool(lst == ForwardList<int>{4, 1, 2, 3}, __LINE__, __FILE__);
+      assertEqual(lst.size(), 4, __LINE__, __FILE__);
+
+      lst.sort();
+      assertBool(lst == ForwardList<int>{1, 2, 3, 4}, __LINE__, __FILE__);
+      lst.push_back(0);
+      assertEqual(lst.back(), 0, __LINE__, __FILE__);
+      lst.sort(std::greater<>());
+      assertBool(lst == ForwardList<int>{4, 3, 2, 1, 0}, __LINE__, __FILE__);
+      assertEqual(lst.back(), 0, __LINE__, __FILE__);
+
+      // The sort is stable.
+      ForwardList<std::pair<int, int>> pairs;
+      for(int i = 0; i < 100; ++i)
+        pairs.emplace_back((i * 37) % 5, i);
+      pairs.sort([](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+      std::pair<int, int> prev{-1, -1};
+      for(const auto& pair : pairs)
+      {
+        assertBool(prev.first < pair.first || (prev.first == pair.first && prev.second < pair.second), __LINE__, __FILE__);
+        prev = pair;
+      }
+
+      ForwardList<std::string> strings{"a", "b"};
+      ForwardList<std::string> copy(strings);
+      assertBool(copy == strings, __LINE__, __FILE__);
+      ForwardList<std::string> moved(std::move(copy));
+      assertBool(copy.empty(), __LINE__, __FILE__);
+      moved.push_back("c");
+      assertBool(moved.back() == "c", __LINE__, __FILE__);
+      copy.push_back("z");
+      assertBool(copy.back() == "z", __LINE__, __FILE__);
+
+      copy = moved;
+      moved = ForwardList<std::string>{"x"};
+      assertBool(copy == ForwardList<std::string>{"a", "b", "c"}, __LINE__, __FILE__);
+      swap(copy, moved);
+      moved.push_back("d");
+      copy.push_back("y");
+      assertBool(moved == ForwardList<std::string>{"a", "b", "c", "d"}, __LINE__, __FILE__);
+      assertBool(copy == ForwardList<std::string>{"x", "y"}, __LINE__, __FILE__);
+
+      // With unequal allocators that do not propagate, splice and swap move the
+      // elements into nodes of the receiving list's own allocator.
+      {
+        CountingResource lhsResource;
+        CountingResource rhsResource;
+        {
+          using PmrList = ForwardList<int, std::pmr::polymorphic_allocator<int>>;
+          PmrList lhs({1, 2}, &lhsResource);
+          PmrList rhs({3, 4, 5}, &rhsResource);
+          std::size_t nodeBytes = rhsResource.live / 3;
+
+          lhs.splice_after(lhs.cbegin(), rhs, rhs.cbefore_begin());
+          assertBool(lhs == PmrList{1, 3, 2}, __LINE__, __FILE__);
+          assertBool(rhs == PmrList{4, 5}, __LINE__, __FILE__);
+          assertEqual(rhsResource.live, 2 * nodeBytes, __LINE__, __FILE__);
+
+          lhs.splice_after(lhs.cbefore_begin(), rhs);
+          assertBool(lhs == PmrList{4, 5, 1, 3, 2}, __LINE__, __FILE__);
+          assertBool(rhs.empty(), __LINE__, __FILE__);
+          assertEqual(rhsResource.live, 0, __LINE__, __FILE__);
+          lhs.push_back(6);
+          assertEqual(lhs.back(), 6, __LINE__, __FILE__);
+
+          rhs.push_back(7);
+          swap(lhs, rhs);
+          assertBool(lhs == PmrList{7}, __LINE__, __FILE__);
+          assertBool(rhs == PmrList{4, 5, 1, 3, 2, 6}, __LINE__, __FILE__);
+          assertEqual(lhsResource.live, nodeBytes, __LINE__, __FILE__);
+          assertEqual(rhsResource.live, 6 * nodeBytes, __LINE__, __FILE__);
+
+          swap(lhs, rhs);
+          assertBool(lhs == PmrList{4, 5, 1, 3, 2, 6}, __LINE__, __FILE__);
+          assertBool(rhs == PmrList{7}, __LINE__, __FILE__);
+          lhs.push_back(8);
+          rhs.push_back(9);
+          assertEqual(lhs.back(), 8, __LINE__, __FILE__);
+          assertEqual(rhs.back(), 9, __LINE__, __FILE__);
+        }
+        assertEqual(lhsResource.live, 0, __LINE__, __FILE__);
+        assertEqual(rhsResource.live, 0, __LINE__, __FILE__);
+      }
+
+      const ForwardList<int> constLst{1, 2, 3};
+      assertEqual(std::distance(constLst.cbegin(), constLst.cend()), 3, __LINE__, __FILE__);
+      assertBool(++constLst.cbefore_begin() == constLst.cbegin(), __LINE__, __FILE__);
+    }
+  };
+
+  static ForwardListTest forwardListTest;
+}
@@ -0,0 +1,106 @@
+#pragma once
+#include "../SmallList.h"
+#include "Fixtures/CustomAsserts.h"
+#include <cstdint>
+#include <string>
+
+namespace test
+{
+  struct SmallListTest
+  {
+    template <typename ListType, typename U>
+    static bool isInline(const ListType& lst, const U& element)
+    {
+      const char* address = reinterpret_cast<const char*>(&element);
+      const char* object = reinterpret_cast<const char*>(&lst);
+      return address >= object && address < object + sizeof(lst);
+    }
+
+    SmallListTest()
+    {
+      SmallList<int, 4> lst;
+      assertEqual(lst.inline_free(), 4, __LINE__, __FILE__);
+      for(int i = 0; i < 4; ++i)
+        lst.push_back(i);
+      assertEqual(lst.inline_free(), 0, __LINE__, __FILE__);
+      for(const int& val : lst)
+        assertBool(isInline(lst, val), __LINE__, __FILE__);
+
+      // Overflow goes to the heap; freed inline nodes are reused first.
+      lst.push_back(4);
+      assertBool(!isInline(lst, lst.back()), __LINE__, __FILE__);
+      lst.pop_front();
+      assertEqual(lst.inline_free(), 1, __LINE__, __FILE__);
+      lst.push_front(-1);
+      assertBool(isInline(lst, lst.front()), __LINE__, __FILE__);
+      assertBool(lst == List<int, InlineAllocator<int>>{-1, 1, 2, 3, 4}, __LINE__, __FILE__);
+
+      lst.clear();
+      assertEqual(lst.inline_free(), 4, __LINE__, __FILE__);
+
+      // Blocks follow List's node layout, including over-aligned values.
+      struct alignas(32) Wide
+      {
+        char bytes[40];
+      };
+      SmallList<Wide, 2> wide;
+      wide.emplace_back();
+      wide.emplace_back();
+      assertEqual(wide.inline_free(), 0, __LINE__, __FILE__);
+      assertBool(isInline(wide, wide.front()) && isInline(wide, wide.back()), __LINE__, __FILE__);
+      assertEqual(reinterpret_cast<std::uintptr_t>(&wide.back()) % 32, 0, __LINE__, __FILE__);
+
+      // Copy and move keep every node inside the destination object.
+      SmallList<std::string, 4> strings{"a", "b", "c"};
+      SmallList<std::string, 4> copy(strings);
+      assertBool(copy == strings, __LINE__, __FILE__);
+      for(const std::string& val : copy)
+        assertBool(isInline(copy, val), __LINE__, __FILE__);
+
+      SmallList<std::string, 4> moved(std::move(copy));
+      assertBool(moved == strings, __LINE__, __FILE__);
+      assertBool(copy.empty(), __LINE__, __FILE__);
+      assertEqual(copy.inline_free(), 4, __LINE__, __FILE__);
+      for(const std::string& val : moved)
+        assertBool(isInline(moved, val), __LINE__, __FILE__);
+
+      copy = moved;
+      moved = SmallList<std::string, 4>{"x"};
+      assertBool(copy == strings, __LINE__, __FILE__);
+      assertEqual(moved.size(), 1, __LINE__, __FILE__);
+      assertEqual(moved.inline_free(), 3, __LINE__, __FILE__);
+
+      swap(copy, moved);
+      assertEqual(copy.size(), 1, __LINE__, __FILE__);
+      assertBool(moved == strings, __LINE__, __FILE__);
+      for(const std::string& val : moved)
+        assertBool(isInline(moved, val), __LINE__, __FILE__);
+      assertEqual(copy.inline_free() + copy.size(), 4, __LINE__, __FILE__);
+
+      // Splice between small lists moves elements into the destination's nodes.
+      copy.splice(copy.end(), moved, ++moved.begin(), moved.end());
+      assertBool(copy == List<std::string, InlineAllocator<std::string>>{"x", "b", "c"}, __LINE__, __FILE__);
+      assertEqual(moved.size(), 1, __LINE__, __FILE__);
+      assertEqual(moved.inline_free(), 3, __LINE__, __FILE__);
+      for(const std::string& val : copy)
+        assertBool(isInline(copy, val), __LINE__, __FILE__);
+
+      copy.splice(copy.begin(), moved);
+      assertBool(moved.empty(), __LINE__, __FILE__);
+      assertEqual(copy.front(), std::string("a"), __LINE__, __FILE__);
+
+      SmallList<int, 4> sorted{1, 4};
+      SmallList<int, 4> other{2, 3, 5};
+      sorted.merge(other);
+      assertBool(sorted == List<int, InlineAllocator<int>>{1, 2, 3, 4, 5}, __LINE__, __FILE__);
+      assertBool(other.empty(), __LINE__, __FILE__);
+
+      // A copy of the plain List part never borrows the source's buffer.
+      List<int, InlineAllocator<int>> heapCopy(sorted);
+      for(int& val : heapCopy)
+        assertBool(!isInline(sorted, val), __LINE__, __FILE__);
+    }
+  };
+
+  static SmallListTest smallListTest;
+}
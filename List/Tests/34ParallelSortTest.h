@@ -0,0 +1,70 @@
+#pragma once
+#include "../List.h"
+#include "Fixtures/CustomAsserts.h"
+#include <atomic>
+#include <utility>
+
+namespace test
+{
+  struct ParallelSortTest
+  {
+    ParallelSortTest()
+    {
+      // Large enough for several workers; many equal keys to check stability.
+      List<std::pair<int, int>> pairs;
+      for(int i = 0; i < 200'000; ++i)
+        pairs.push_back({(i * 7919) % 1000, i});
+
+      auto byKey = [](const auto& lhs, const auto& rhs){ return lhs.first < rhs.first; };
+      List<std::pair<int, int>> expected(pairs);
+      expected.sort(byKey);
+
+      for(size_t threads : {size_t(2), size_t(3), size_t(4), size_t(7)})
+      {
+        List<std::pair<int, int>> copy(pairs);
+        copy.parallel_sort(threads, byKey);
+        assertBool(copy == expected, __LINE__, __FILE__);
+        assertEqual(copy.size(), 200'000, __LINE__, __FILE__);
+        assertEqual(copy.back().first, 999, __LINE__, __FILE__);
+
+        // The _prev links are rebuilt as well.
+        auto rit = copy.rbegin();
+        auto rexpected = expected.rbegin();
+        for(int i = 0; i < 1000; ++i, ++rit, ++rexpected)
+          assertBool(*rit == *rexpected, __LINE__, __FILE__);
+      }
+
+      // Workers are pool threads, started once and reused by later calls.
+      std::size_t poolThreads = detail::WorkerPool::instance().size();
+      assertGreater(poolThreads, 5, __LINE__, __FILE__);
+      for(int i = 0; i < 3; ++i)
+      {
+        List<std::pair<int, int>> copy(pairs);
+        copy.parallel_sort(7, byKey);
+        assertBool(copy == expected, __LINE__, __FILE__);
+      }
+      assertEqual(detail::WorkerPool::instance().size(), poolThreads, __LINE__, __FILE__);
+
+      // A task may fork again: whoever submits a job also works through it, so
+      // nested jobs finish even when every pool thread is waiting.
+      std::atomic<int> calls = 0;
+      detail::fork_join(8, [&](std::size_t){
+        detail::fork_join(8, [&](std::size_t){ ++calls; });
+      });
+      assertEqual(calls.load(), 64, __LINE__, __FILE__);
+
+      // Small lists and threads = 0 (hardware concurrency) fall back as needed.
+      List<int> lst{6, 5, 1, 2, 4, 3, 7};
+      lst.parallel_sort();
+      assertBool(lst == List<int>{1, 2, 3, 4, 5, 6, 7}, __LINE__, __FILE__);
+      lst.parallel_sort(8, [](int lhs, int rhs){ return lhs > rhs; });
+      assertBool(lst == List<int>{7, 6, 5, 4, 3, 2, 1}, __LINE__, __FILE__);
+
+      List<int> empty;
+      empty.parallel_sort(4);
+      assertBool(empty.empty(), __LINE__, __FILE__);
+    }
+  };
+
+  static ParallelSortTest parallelSortTest;
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include "../List.h"
+#include "Fixtures/CustomAsserts.h"
+#include <string>
+
+namespace test
+{
+  struct ParallelTraversalTest
+  {
+    ParallelTraversalTest()
+    {
+      List<int> lst;
+      for(int i = 1; i <= 100'000; ++i)
+        lst.push_back(i);
+
+      for(size_t threads : {size_t(1), size_t(2), size_t(3), size_t(6)})
+      {
+        long long sum = lst.parallel_transform_reduce(0LL, std::plus<>(), [](int val){ return static_cast<long long>(val); }, threads);
+        assertEqual(sum, 5'000'050'000LL, __LINE__, __FILE__);
+
+        size_t even = lst.parallel_count_if([](int val){ return val % 2 == 0; }, threads);
+        assertEqual(even, 50'000, __LINE__, __FILE__);
+
+        // A predicate with a non-const call operator; each worker gets its own copy.
+        size_t thirds = lst.parallel_count_if([seen = size_t(0)](int val) mutable { ++seen; return val % 3 == 0; }, threads);
+        assertEqual(thirds, 33'333, __LINE__, __FILE__);
+      }
+
+      lst.parallel_for_each([](int& val){ val *= 2; }, 4);
+      int expected = 0;
+      for(int val : lst)
+        assertEqual(val, expected += 2, __LINE__, __FILE__);
+
+      // Reduce only needs to be associative: partial results are folded in order.
+      List<std::string> words;
+      for(int i = 0; i < 40'000; ++i)
+        words.push_back(std::string(1, static_cast<char>('a' + i % 26)));
+      std::string joined = words.parallel_transform_reduce(std::string(), std::plus<>(), [](const std::string& word){ return word; }, 3);
+      std::string serial;
+      for(const std::string& word : words)
+        serial += word;
+      assertBool(joined == serial, __LINE__, __FILE__);
+
+      const List<int> small{1, 2, 3};
+      assertEqual(small.parallel_count_if([](int val){ return val > 1; }, 8), 2, __LINE__, __FILE__);
+      assertEqual(small.parallel_transform_reduce(10, std::plus<>(), [](int val){ return val; }), 16, __LINE__, __FILE__);
+
+      List<int> empty;
+      assertEqual(empty.parallel_transform_reduce(7, std::plus<>(), [](int val){ return val; }, 4), 7, __LINE__, __FILE__);
+      assertEqual(empty.parallel_count_if([](int){ return true; }), 0, __LINE__, __FILE__);
+      empty.parallel_for_each([](int&){ throw 0; });
+    }
+  };
+
+  static ParallelTraversalTest parallelTraversalTest;
+}
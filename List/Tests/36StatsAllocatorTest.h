@@ -0,0 +1,90 @@
+#pragma once
+#include "../List.h"
+#include "../StatsAllocator.h"
+#include "Fixtures/CustomAsserts.h"
+#include <string>
+
+namespace test
+{
+  struct StatsAllocatorTest
+  {
+    StatsAllocatorTest()
+    {
+      using StatsList = List<int, StatsAllocator<int>>;
+
+      StatsList lst;
+      lst.push_back(3);
+      lst.push_back(1);
+      lst.push_front(2);
+      lst.emplace_back(5);
+
+      ListStats stats = lst.get_allocator().stats();
+      assertEqual(stats.live_nodes, 4, __LINE__, __FILE__);
+      assertEqual(stats.allocations, 4, __LINE__, __FILE__);
+      assertEqual(stats.deallocations, 0, __LINE__, __FILE__);
+      assertEqual(stats.pushes, 4, __LINE__, __FILE__);
+      assertGreater(stats.bytes_in_use, 4 * sizeof(int), __LINE__, __FILE__);
+      assertEqual(stats.peak_bytes, stats.bytes_in_use, __LINE__, __FILE__);
+      std::size_t nodeBytes = stats.bytes_in_use / 4;
+
+      lst.insert(lst.begin(), 2, 9);
+      lst.emplace(lst.end(), 4);
+      lst.pop_front();
+      lst.erase(lst.begin());
+      lst.sort();
+
+      stats = lst.get_allocator().stats();
+      assertEqual(stats.inserts, 3, __LINE__, __FILE__);
+      assertEqual(stats.pops, 1, __LINE__, __FILE__);
+      assertEqual(stats.erases, 1, __LINE__, __FILE__);
+      assertEqual(stats.sorts, 1, __LINE__, __FILE__);
+      assertGreater(stats.comparisons, 0, __LINE__, __FILE__);
+      assertEqual(stats.live_nodes, 5, __LINE__, __FILE__);
+      assertEqual(stats.bytes_in_use, 5 * nodeBytes, __LINE__, __FILE__);
+      assertEqual(stats.peak_bytes, 7 * nodeBytes, __LINE__, __FILE__);
+      assertEqual(stats.deallocations, 2, __LINE__, __FILE__);
+
+      // Merge counts its comparisons too: sorted {0, 10} into {1, 2, 3, 4, 5}.
+      StatsList other(lst.get_allocator());
+      other.push_back(0);
+      other.push_back(10);
+      lst.get_allocator().reset_stats();
+      lst.merge(other);
+      stats = lst.get_allocator().stats();
+      assertEqual(stats.live_nodes, 7, __LINE__, __FILE__);
+      assertEqual(stats.peak_bytes, stats.bytes_in_use, __LINE__, __FILE__);
+      assertEqual(stats.allocations, 0, __LINE__, __FILE__);
+      assertEqual(stats.comparisons, 7, __LINE__, __FILE__);
+      assertEqual(stats.pushes, 0, __LINE__, __FILE__);
+
+      // A copy keeps counters of its own.
+      {
+        StatsList copy(lst);
+        assertEqual(copy.get_allocator().stats().live_nodes, 7, __LINE__, __FILE__);
+        assertBool(copy.get_allocator() != lst.get_allocator(), __LINE__, __FILE__);
+      }
+      assertEqual(lst.get_allocator().stats().live_nodes, 7, __LINE__, __FILE__);
+
+      lst.parallel_sort(2, std::greater<>());
+      stats = lst.get_allocator().stats();
+      assertEqual(stats.sorts, 1, __LINE__, __FILE__);
+      assertGreater(stats.comparisons, 7, __LINE__, __FILE__);
+      assertEqual(lst.front(), 10, __LINE__, __FILE__);
+
+      std::string json = stats.to_json();
+      assertBool(json.front() == '{' && json.back() == '}', __LINE__, __FILE__);
+      assertBool(json.find("\"live_nodes\": 7") != std::string::npos, __LINE__, __FILE__);
+      assertBool(json.find("\"sorts\": 1") != std::string::npos, __LINE__, __FILE__);
+
+      lst.clear();
+      stats = lst.get_allocator().stats();
+      assertEqual(stats.live_nodes, 0, __LINE__, __FILE__);
+      assertEqual(stats.bytes_in_use, 0, __LINE__, __FILE__);
+
+      // Lists with a plain allocator carry no counters at all.
+      static_assert(sizeof(List<int>) == 3 * sizeof(void*));
+    }
+  };
+
+  static StatsAllocatorTest statsAllocatorTest;
+}
@@ -0,0 +1,96 @@
+#pragma once
+#include "../List.h"
+#include "Fixtures/AllocationCounter.h"
+#include "Fixtures/CustomAsserts.h"
+#include <utility>
+#include <vector>
+
+namespace test
+{
+  // Runs operation and asserts how many heap allocations and deallocations it made
+  // and how many times it copied or moved an element.
+  template <typename Operation>
+  void assertBudget(Operation operation, std::size_t allocations, std::size_t deallocations,
+                    std::size_t copies, std::size_t moves, int line)
+  {
+    Tracked::reset();
+    AllocationScope scope;
+    operation();
+    assertEqual(scope.allocations(), allocations, line, __FILE__);
+    assertEqual(scope.deallocations(), deallocations, line, __FILE__);
+    assertEqual(Tracked::copies, copies, line, __FILE__);
+    assertEqual(Tracked::moves, moves, line, __FILE__);
+  }
+
+  // One node allocation per element and nothing else: the sentinel lives inside the
+  // list object, and relinking operations neither allocate nor touch the elements.
+  struct AllocationBudgetTest
+  {
+    AllocationBudgetTest()
+    {
+      using TrackedList = List<Tracked>;
+
+      const Tracked seed(7);
+      const std::vector<Tracked> source{5, 3, 8, 1, 9, 2, 7, 4, 6, 0};
+
+      // Construction and destruction.
+      assertBudget([]{ TrackedList lst; }, 0, 0, 0, 0, __LINE__);
+      assertBudget([&]{ TrackedList lst(10, seed); }, 10, 10, 10, 0, __LINE__);
+      assertBudget([&]{ TrackedList lst(10); }, 10, 10, 0, 0, __LINE__);
+      assertBudget([&]{ TrackedList lst(source.begin(), source.end()); }, 10, 10, 10, 0, __LINE__);
+
+      TrackedList lst(source.begin(), source.end());
+      assertBudget([&]{ TrackedList copy(lst); }, 10, 10, 10, 0, __LINE__);
+      assertBudget([&]{ TrackedList moved(std::move(lst)); lst = std::move(moved); }, 0, 0, 0, 0, __LINE__);
+
+      // Assignment reuses the existing nodes and only allocates or frees the difference.
+      {
+        TrackedList same(10, seed);
+        TrackedList shorter(4, seed);
+        TrackedList longer(15, seed);
+        assertBudget([&]{ same = lst; }, 0, 0, 10, 0, __LINE__);
+        assertBudget([&]{ shorter = lst; }, 6, 0, 10, 0, __LINE__);
+        assertBudget([&]{ longer = lst; }, 0, 5, 10, 0, __LINE__);
+        assertBudget([&]{ longer = std::move(shorter); }, 0, 10, 0, 0, __LINE__);
+        assertBudget([&]{ same.assign(3, seed); }, 3, 10, 3, 0, __LINE__);
+      }
+
+      // Push, emplace and pop.
+      assertBudget([&]{ lst.push_back(seed); }, 1, 0, 1, 0, __LINE__);
+      assertBudget([&]{ lst.push_front(Tracked(1)); }, 1, 0, 0, 1, __LINE__);
+      assertBudget([&]{ lst.emplace_back(3); }, 1, 0, 0, 0, __LINE__);
+      assertBudget([&]{ lst.emplace_front(4); }, 1, 0, 0, 0, __LINE__);
+      assertBudget([&]{ lst.pop_back(); lst.pop_front(); }, 0, 2, 0, 0, __LINE__);
+      assertBudget([&]{ lst.pop_back(); lst.pop_front(); }, 0, 2, 0, 0, __LINE__);
+      assertEqual(lst.size(), 10, __LINE__, __FILE__);
+
+      // Insert and erase.
+      auto middle = std::next(lst.begin(), 5);
+      assertBudget([&]{ lst.insert(middle, seed); }, 1, 0, 1, 0, __LINE__);
+      assertBudget([&]{ lst.emplace(middle, 2); }, 1, 0, 0, 0, __LINE__);
+      assertBudget([&]{ lst.insert(middle, 3, seed); }, 3, 0, 3, 0, __LINE__);
+      assertBudget([&]{ lst.insert(middle, source.begin(), source.begin() + 4); }, 4, 0, 4, 0, __LINE__);
+      assertBudget([&]{ lst.erase(std::prev(middle)); }, 0, 1, 0, 0, __LINE__);
+      assertEqual(lst.size(), 18, __LINE__, __FILE__);
+
+      // Sorting and merging only relink nodes.
+      TrackedList other(source.begin(), source.end());
+      assertBudget([&]{ lst.sort(); other.sort(); }, 0, 0, 0, 0, __LINE__);
+      assertBudget([&]{ lst.parallel_sort(1); }, 0, 0, 0, 0, __LINE__);
+      assertBudget([&]{ lst.merge(other); }, 0, 0, 0, 0, __LINE__);
+      assertEqual(lst.size(), 28, __LINE__, __FILE__);
+      assertBudget([&]{ other.splice(other.end(), lst, lst.begin(), std::next(lst.begin(), 8)); }, 0, 0, 0, 0, __LINE__);
+      assertBudget([&]{ lst.swap(other); }, 0, 0, 0, 0, __LINE__);
+
+      // Bulk removal frees exactly the removed nodes.
+      assertBudget([&]{ other.erase(other.begin(), std::next(other.begin(), 5)); }, 0, 5, 0, 0, __LINE__);
+      assertBudget([&]{ lst.remove_if([](const Tracked&){ return true; }); }, 0, 8, 0, 0, __LINE__);
+
+      // Clearing frees every node once.
+      assertBudget([&]{ lst.clear(); other.clear(); }, 0, 15, 0, 0, __LINE__);
+      assertBudget([&]{ lst.clear(); }, 0, 0, 0, 0, __LINE__);
+    }
+  };
+
+  static AllocationBudgetTest allocationBudgetTest;
+}
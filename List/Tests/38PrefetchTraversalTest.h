@@ -0,0 +1,51 @@
+#pragma once
+#include "../List.h"
+#include "Fixtures/CustomAsserts.h"
+#include <string>
+
+namespace test
+{
+  struct PrefetchTraversalTest
+  {
+    PrefetchTraversalTest()
+    {
+      List<int> lst;
+      for(int i = 1; i <= 1'000; ++i)
+        lst.push_back(i);
+
+      // Distances shorter than, equal to and longer than the list, and no prefetch at all.
+      for(size_t distance : {size_t(0), size_t(1), size_t(8), size_t(1'000), size_t(5'000)})
+      {
+        assertEqual(lst.accumulate_prefetch(0LL, std::plus<>(), distance), 500'500LL, __LINE__, __FILE__);
+        assertEqual(lst.count_if_prefetch([](int val){ return val % 3 == 0; }, distance), 333, __LINE__, __FILE__);
+
+        auto found = lst.find_prefetch(777, distance);
+        assertBool(found != lst.end(), __LINE__, __FILE__);
+        assertEqual(*found, 777, __LINE__, __FILE__);
+        assertBool(lst.find_prefetch(0, distance) == lst.end(), __LINE__, __FILE__);
+
+        int expected = 0;
+        lst.for_each_prefetch([&expected](int val){ assertEqual(val, ++expected, __LINE__, __FILE__); }, distance);
+        assertEqual(expected, 1'000, __LINE__, __FILE__);
+      }
+
+      // Elements are visited in order and may be modified.
+      lst.for_each_prefetch([](int& val){ val *= 2; });
+      assertEqual(lst.front(), 2, __LINE__, __FILE__);
+      assertEqual(lst.back(), 2'000, __LINE__, __FILE__);
+      assertBool(lst.find_prefetch(2'000) == std::prev(lst.end()), __LINE__, __FILE__);
+
+      List<std::string> words{"a", "b", "c"};
+      assertBool(words.accumulate_prefetch(std::string()) == "abc", __LINE__, __FILE__);
+      assertBool(words.accumulate_prefetch(std::string(), [](std::string acc, const std::string& word){ return word + acc; }) == "cba", __LINE__, __FILE__);
+
+      const List<int> empty;
+      assertEqual(empty.accumulate_prefetch(7), 7, __LINE__, __FILE__);
+      assertEqual(empty.count_if_prefetch([](int){ return true; }), 0, __LINE__, __FILE__);
+      assertBool(empty.find_prefetch(1) == empty.end(), __LINE__, __FILE__);
+      empty.for_each_prefetch([](int){ throw 0; });
+    }
+  };
+
+  static PrefetchTraversalTest prefetchTraversalTest;
+}
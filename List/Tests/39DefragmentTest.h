@@ -0,0 +1,74 @@
+#pragma once
+#include "../List.h"
+#include "../PoolAllocator.h"
+#include "Fixtures/CustomAsserts.h"
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace test
+{
+  struct DefragmentTest
+  {
+    DefragmentTest()
+    {
+      // A fresh pool slab hands out blocks in address order; sorting random keys
+      // then relinks the nodes into an order unrelated to their addresses.
+      using PoolList = List<int, PoolAllocator<int, 8>>;
+      PoolList lst;
+      lst.reserve_nodes(1'000);
+      std::mt19937 rng(3);
+      for(int i = 0; i < 1'000; ++i)
+        lst.push_back(static_cast<int>(rng() % 100'000));
+      assertEqual(lst.locality(), 1.0, __LINE__, __FILE__);
+
+      lst.sort();
+      std::vector<int> expected(lst.begin(), lst.end());
+      assertLess(lst.locality(), 0.1, __LINE__, __FILE__);
+      auto slabs = lst.get_allocator().slab_count();
+
+      auto end = lst.end();
+      lst.defragment();
+      assertEqual(lst.locality(), 1.0, __LINE__, __FILE__);
+      assertBool(std::vector<int>(lst.begin(), lst.end()) == expected, __LINE__, __FILE__);
+      assertBool(end == lst.end(), __LINE__, __FILE__);
+      assertEqual(lst.size(), 1'000, __LINE__, __FILE__);
+
+      // The old, now empty slab can be given back.
+      lst.shrink_to_fit();
+      assertEqual(lst.get_allocator().slab_count(), slabs, __LINE__, __FILE__);
+
+      // Incremental: a bounded number of nodes per call, continuing where the last one stopped.
+      lst.sort(std::greater<>());
+      expected.assign(lst.begin(), lst.end());
+      auto second = std::next(lst.begin());
+      int calls = 0;
+      for(auto it = std::next(lst.begin(), 2); it != lst.end(); ++calls)
+        it = lst.defragment(it, 64);
+      assertEqual(calls, 16, __LINE__, __FILE__);
+      assertBool(std::vector<int>(lst.begin(), lst.end()) == expected, __LINE__, __FILE__);
+      assertEqual(*second, expected[1], __LINE__, __FILE__);
+      assertEqual(lst.size(), 1'000, __LINE__, __FILE__);
+      assertBool(lst.defragment(lst.end(), 10) == lst.end(), __LINE__, __FILE__);
+      assertBool(lst.defragment(lst.begin(), 0) == lst.begin(), __LINE__, __FILE__);
+
+      // Move-only and heap-owning elements are moved, not copied.
+      List<std::unique_ptr<int>> owners;
+      for(int i = 0; i < 10; ++i)
+        owners.push_back(std::make_unique<int>(i));
+      int* third = std::next(owners.begin(), 2)->get();
+      owners.defragment();
+      assertEqual(owners.size(), 10, __LINE__, __FILE__);
+      assertBool(std::next(owners.begin(), 2)->get() == third, __LINE__, __FILE__);
+      assertEqual(*owners.back(), 9, __LINE__, __FILE__);
+
+      List<std::string> empty;
+      empty.defragment();
+      assertEqual(empty.locality(), 1.0, __LINE__, __FILE__);
+      assertBool(empty.empty(), __LINE__, __FILE__);
+    }
+  };
+
+  static DefragmentTest defragmentTest;
+}
@@ -0,0 +1,83 @@
+#pragma once
+#include "../List.h"
+#include "../StatsAllocator.h"
+#include "Fixtures/CustomAsserts.h"
+#include <cmath>
+#include <string>
+
+namespace test
+{
+  struct BulkRemoveTest
+  {
+    BulkRemoveTest()
+    {
+      // erase returns the element that followed what was erased.
+      List<int> lst{1, 2, 3, 4, 5, 6, 7};
+      auto next = lst.erase(std::next(lst.begin()));
+      assertEqual(*next, 3, __LINE__, __FILE__);
+      next = lst.erase(next, std::next(next, 3));
+      assertEqual(*next, 6, __LINE__, __FILE__);
+      assertBool(lst == List<int>({1, 6, 7}), __LINE__, __FILE__);
+      next = lst.erase(next, next);
+      assertEqual(*next, 6, __LINE__, __FILE__);
+      assertEqual(lst.size(), 3, __LINE__, __FILE__);
+      assertBool(lst.erase(std::prev(lst.end())) == lst.end(), __LINE__, __FILE__);
+      assertBool(lst.erase(lst.begin(), lst.end()) == lst.end(), __LINE__, __FILE__);
+      assertBool(lst.empty(), __LINE__, __FILE__);
+
+      List<int> numbers;
+      for(int i = 0; i < 100; ++i)
+        numbers.push_back(i % 10);
+      assertEqual(numbers.remove(3), 10, __LINE__, __FILE__);
+      assertEqual(numbers.remove_if([](int val){ return val % 2 == 0; }), 50, __LINE__, __FILE__);
+      assertEqual(numbers.size(), 40, __LINE__, __FILE__);
+      assertEqual(numbers.remove(4), 0, __LINE__, __FILE__);
+      for(int val : numbers)
+        assertBool(val == 1 || val == 5 || val == 7 || val == 9, __LINE__, __FILE__);
+
+      // The value may be an element of the list itself: nodes are freed after the pass.
+      List<std::string> words{"a", "b", "a", "c", "a"};
+      assertEqual(words.remove(words.front()), 3, __LINE__, __FILE__);
+      assertBool(words == List<std::string>({"b", "c"}), __LINE__, __FILE__);
+
+      List<int> runs{1, 1, 2, 2, 2, 1, 3, 3};
+      assertEqual(runs.unique(), 4, __LINE__, __FILE__);
+      assertBool(runs == List<int>({1, 2, 1, 3}), __LINE__, __FILE__);
+      assertEqual(runs.back(), 3, __LINE__, __FILE__);
+      assertEqual(*std::prev(runs.end(), 2), 1, __LINE__, __FILE__);
+
+      // The predicate compares with the last element kept, not the last one seen.
+      List<int> close{1, 2, 3, 4, 5, 9, 10};
+      assertEqual(close.unique([](int kept, int val){ return std::abs(val - kept) <= 2; }), 4, __LINE__, __FILE__);
+      assertBool(close == List<int>({1, 4, 9}), __LINE__, __FILE__);
+
+      // A throwing predicate leaves the elements it has not reached in place.
+      List<int> partial{1, 2, 3, 4, 5};
+      try
+      {
+        partial.remove_if([](int val){ if(val == 4) throw val; return val % 2 == 1; });
+        assertBool(false, __LINE__, __FILE__);
+      }
+      catch(int)
+      {
+      }
+      assertBool(partial == List<int>({2, 4, 5}), __LINE__, __FILE__);
+      assertEqual(partial.size(), 3, __LINE__, __FILE__);
+
+      // Removed elements are reported as erasures and every node is freed.
+      List<int, StatsAllocator<int>> tracked{1, 2, 2, 3, 4, 4};
+      tracked.unique();
+      tracked.remove_if([](int val){ return val > 2; });
+      tracked.erase(tracked.begin(), tracked.end());
+      ListStats stats = tracked.get_allocator().stats();
+      assertEqual(stats.erases, 6, __LINE__, __FILE__);
+      assertEqual(stats.live_nodes, 0, __LINE__, __FILE__);
+
+      List<int> empty;
+      assertEqual(empty.remove(1), 0, __LINE__, __FILE__);
+      assertEqual(empty.unique(), 0, __LINE__, __FILE__);
+    }
+  };
+
+  static BulkRemoveTest bulkRemoveTest;
+}
@@ -0,0 +1,153 @@
+#pragma once
+#include "../IndexedList.h"
+#include "../StatsAllocator.h"
+#include "Fixtures/CustomAsserts.h"
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace test
+{
+  struct IndexedListTest
+  {
+    template <typename ListType>
+    static void assertMatches(const ListType& lst, const std::vector<int>& expected, int line)
+    {
+      assertEqual(lst.size(), expected.size(), line, __FILE__);
+      assertBool(std::vector<int>(lst.begin(), lst.end()) == expected, line, __FILE__);
+      for(std::size_t i = 0; i < expected.size(); ++i)
+      {
+        assertEqual(lst.at(i), expected[i], line, __FILE__);
+        assertEqual(lst.index_of(lst.iterator_at(i)), i, line, __FILE__);
+      }
+    }
+
+    IndexedListTest()
+    {
+      IndexedList<int> lst;
+      assertBool(lst.empty(), __LINE__, __FILE__);
+      assertBool(lst.iterator_at(0) == lst.end(), __LINE__, __FILE__);
+      assertEqual(lst.index_of(lst.end()), 0, __LINE__, __FILE__);
+
+      for(int i = 0; i < 10; ++i)
+        lst.push_back(i);
+      assertMatches(lst, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9}, __LINE__);
+
+      auto it = lst.insert_at(3, 100);
+      assertEqual(*it, 100, __LINE__, __FILE__);
+      lst.insert_at(0, -1);
+      lst.insert_at(50, 10);
+      assertMatches(lst, {-1, 0, 1, 2, 100, 3, 4, 5, 6, 7, 8, 9, 10}, __LINE__);
+      assertEqual(lst.index_of(it), 4, __LINE__, __FILE__);
+      assertEqual(lst.index_of(lst.end()), 13, __LINE__, __FILE__);
+
+      assertEqual(*lst.erase_at(4), 3, __LINE__, __FILE__);
+      lst.pop_front();
+      lst.pop_back();
+      lst[0] = 42;
+      assertMatches(lst, {42, 1, 2, 3, 4, 5, 6, 7, 8, 9}, __LINE__);
+
+      try
+      {
+        lst.at(10);
+        assertBool(false, __LINE__, __FILE__);
+      }
+      catch(const std::out_of_range&)
+      {
+      }
+
+      try
+      {
+        lst.erase_at(lst.size());
+        assertBool(false, __LINE__, __FILE__);
+      }
+      catch(const std::out_of_range&)
+      {
+      }
+      assertMatches(lst, {42, 1, 2, 3, 4, 5, 6, 7, 8, 9}, __LINE__);
+
+      // Random inserts and erases at positions and at iterators keep every index
+      // in step with a vector doing the same edits.
+      std::mt19937 rng(11);
+      std::vector<int> expected(lst.begin(), lst.end());
+      auto tracked = lst.begin();
+      for(int i = 0; i < 5'000; ++i)
+      {
+        std::size_t index = rng() % (expected.size() + 1);
+        switch(rng() % 4)
+        {
+        case 0:
+        case 1:
+          lst.insert_at(index, i);
+          expected.insert(expected.begin() + index, i);
+          break;
+        case 2:
+          lst.insert(lst.iterator_at(index), i);
+          expected.insert(expected.begin() + index, i);
+          break;
+        default:
+          if(index < expected.size() && lst.iterator_at(index) != tracked)
+          {
+            lst.erase(lst.iterator_at(index));
+            expected.erase(expected.begin() + index);
+          }
+          break;
+        }
+      }
+      assertMatches(lst, expected, __LINE__);
+      assertEqual(*tracked, 42, __LINE__, __FILE__);
+      assertEqual(lst.index_of(tracked), static_cast<std::size_t>(std::find(expected.begin(), expected.end(), 42) - expected.begin()), __LINE__, __FILE__);
+
+      // Copies, moves and swaps carry the index along.
+      IndexedList<int> copy(lst);
+      assertMatches(copy, expected, __LINE__);
+      IndexedList<int> moved(std::move(copy));
+      assertMatches(moved, expected, __LINE__);
+      assertBool(copy.empty(), __LINE__, __FILE__);
+      copy = IndexedList<int>{1, 2, 3};
+      swap(copy, moved);
+      assertMatches(copy, expected, __LINE__);
+      assertMatches(moved, {1, 2, 3}, __LINE__);
+      moved = copy;
+      assertBool(moved == copy, __LINE__, __FILE__);
+
+      while(!moved.empty())
+        moved.erase(moved.begin());
+      assertBool(moved.begin() == moved.end(), __LINE__, __FILE__);
+      moved.push_front(7);
+      assertMatches(moved, {7}, __LINE__);
+
+      // Index entries come from the same allocator and are all given back.
+      IndexedList<std::string, StatsAllocator<std::string>> words;
+      for(int i = 0; i < 1'000; ++i)
+        words.insert_at(words.size() / 2, std::to_string(i));
+      ListStats stats = words.get_allocator().stats();
+      assertGreater(stats.live_nodes, 1'000, __LINE__, __FILE__);
+      assertEqual(words.at(499), "999", __LINE__, __FILE__);
+      std::string longWord(64, 'x');
+      words.push_back(std::move(longWord));
+      assertBool(longWord.empty(), __LINE__, __FILE__);
+      longWord.assign(64, 'y');
+      words.push_front(std::move(longWord));
+      assertBool(longWord.empty(), __LINE__, __FILE__);
+      assertEqual(words.front(), std::string(64, 'y'), __LINE__, __FILE__);
+      assertEqual(words.back(), std::string(64, 'x'), __LINE__, __FILE__);
+      words.pop_front();
+      words.pop_back();
+      for(int i = 0; i < 600; ++i)
+        words.erase_at(words.size() - 1 - i % words.size());
+      assertEqual(words.size(), 400, __LINE__, __FILE__);
+      words.clear();
+      assertEqual(words.get_allocator().stats().live_nodes, 0, __LINE__, __FILE__);
+
+      const IndexedList<int> constLst{1, 2, 3};
+      assertEqual(constLst[1], 2, __LINE__, __FILE__);
+      assertEqual(*constLst.iterator_at(2), 3, __LINE__, __FILE__);
+      assertEqual(*constLst.crbegin(), 3, __LINE__, __FILE__);
+    }
+  };
+
+  static IndexedListTest indexedListTest;
+}
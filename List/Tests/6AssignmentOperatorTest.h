@@ -35,7 +35,24 @@ namespace test
   	  assertEqual(lst2.back(), 2, __LINE__, __FILE__);
       lst2.pop_back();
   	  assertEqual(lst2.back(), 1, __LINE__, __FILE__);
-      
+
+      // Assignment reuses the nodes it already has and only allocates or frees the difference.
+      List<int> lst3{1, 2, 3};
+      List<int> lst4{7, 8};
+      const int* first = &lst4.front();
+      lst4 = lst3;
+      assertBool(lst4 == lst3, __LINE__, __FILE__);
+      assertBool(&lst4.front() == first, __LINE__, __FILE__);
+      assertEqual(lst4.size(), 3, __LINE__, __FILE__);
+
+      List<int> lst5{4};
+      lst4 = lst5;
+      assertBool(lst4 == lst5, __LINE__, __FILE__);
+      assertBool(&lst4.front() == first, __LINE__, __FILE__);
+      assertEqual(lst4.size(), 1, __LINE__, __FILE__);
+
+      lst4 = List<int>();
+      assertBool(lst4.empty(), __LINE__, __FILE__);
     }
   };
   
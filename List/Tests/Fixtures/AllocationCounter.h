@@ -0,0 +1,150 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+// Replaces the global allocation functions of the test and benchmark executables
+// so that tests can assert, and benchmarks report, how many times an operation
+// reached the heap. Include from exactly one translation unit.
+namespace test
+{
+  // Atomic because the worker pool of the parallel algorithms allocates too.
+  inline std::atomic<std::size_t> allocationCounter = 0;
+  inline std::atomic<std::size_t> deallocationCounter = 0;
+  // Bytes requested from the heap so far (never decremented).
+  inline std::atomic<std::size_t> allocatedBytesCounter = 0;
+
+  // Counts the heap allocations and deallocations made during its lifetime.
+  class AllocationScope
+  {
+  private:
+    std::size_t startAllocations;
+    std::size_t startDeallocations;
+
+  public:
+    AllocationScope()
+      : startAllocations(allocationCounter), startDeallocations(deallocationCounter)
+    {
+    }
+
+    std::size_t allocations() const
+    {
+      return allocationCounter - startAllocations;
+    }
+
+    std::size_t deallocations() const
+    {
+      return deallocationCounter - startDeallocations;
+    }
+  };
+
+  // Counts how its instances are created, so tests can check that an operation
+  // copies or moves elements exactly as often as it should.
+  struct Tracked
+  {
+    inline static std::size_t copies = 0;
+    inline static std::size_t moves = 0;
+
+    int value;
+
+    Tracked(int value = 0)
+      : value(value)
+    {
+    }
+
+    Tracked(const Tracked& other)
+      : value(other.value)
+    {
+      ++copies;
+    }
+
+    Tracked(Tracked&& other) noexcept
+      : value(other.value)
+    {
+      ++moves;
+    }
+
+    Tracked& operator=(const Tracked& other)
+    {
+      value = other.value;
+      ++copies;
+      return *this;
+    }
+
+    Tracked& operator=(Tracked&& other) noexcept
+    {
+      value = other.value;
+      ++moves;
+      return *this;
+    }
+
+    bool operator<(const Tracked& other) const
+    {
+      return value < other.value;
+    }
+
+    bool operator==(const Tracked& other) const
+    {
+      return value == other.value;
+    }
+
+    static void reset()
+    {
+      copies = 0;
+      moves = 0;
+    }
+  };
+}
+
+void* operator new(std::size_t size)
+{
+  ++test::allocationCounter;
+  test::allocatedBytesCounter += size;
+  if(void* ptr = std::malloc(size ? size : 1))
+    return ptr;
+  throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+  ++test::allocationCounter;
+  test::allocatedBytesCounter += size;
+  std::size_t align = static_cast<std::size_t>(alignment);
+#if defined(_MSC_VER)
+  if(void* ptr = _aligned_malloc(size ? size : 1, align))
+#else
+  if(void* ptr = std::aligned_alloc(align, (size + align - 1) / align * align + (size ? 0 : align)))
+#endif
+    return ptr;
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+  if(ptr)
+    ++test::deallocationCounter;
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+  operator delete(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+  if(ptr)
+    ++test::deallocationCounter;
+#if defined(_MSC_VER)
+  _aligned_free(ptr);
+#else
+  std::free(ptr);
+#endif
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t alignment) noexcept
+{
+  operator delete(ptr, alignment);
+}
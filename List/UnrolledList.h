@@ -0,0 +1,960 @@
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+// Doubly linked list of blocks holding up to K elements each. Scans touch one
+// block header per K elements instead of one node per element. Blocks are split
+// when inserting into a full block and merged when erasing leaves a block less
+// than a quarter full, so insert and erase at a position stay O(K).
+//
+// Unlike List, inserting or erasing invalidates the iterators into the block(s)
+// involved, since elements shift within and between blocks.
+//
+// Elements whose move constructor may throw are copied instead. An insert or
+// erase inside such a block builds a replacement block, and if a copy throws the
+// list is left as it was.
+template <typename T, size_t K = 16, typename Alloc = std::allocator<T>>
+class UnrolledList
+{
+	static_assert(K >= 2, "UnrolledList needs at least two elements per block");
+
+public:
+
+	using allocator_type = Alloc;
+
+private:
+
+#pragma region Block
+
+	struct NodeBase
+	{
+		NodeBase* _next;
+		NodeBase* _prev;
+
+		NodeBase(NodeBase* next = nullptr, NodeBase* prev = nullptr);
+	};
+
+	struct Block : NodeBase
+	{
+		size_t _count;
+
+		union
+		{
+			T _vals[K];
+		};
+
+		Block(NodeBase* next, NodeBase* prev);
+		~Block();
+	};
+
+	using AllocTraits = std::allocator_traits<Alloc>;
+	using BlockAlloc = typename AllocTraits::template rebind_alloc<Block>;
+	using BlockTraits = std::allocator_traits<BlockAlloc>;
+
+	static Block* block(NodeBase* node);
+	static const Block* block(const NodeBase* node);
+
+	Block* create_block(NodeBase* next, NodeBase* prev);
+	void destroy_block(NodeBase* node);
+	template <typename... Args>
+	void construct_at(Block* target, size_t index, Args&&... args);
+	void relocate(Block* from, size_t fromIndex, Block* to, size_t toIndex);
+	void transfer(Block* from, size_t first, size_t last, Block* to);
+	Block* split(Block* full);
+	void merge_next(Block* target);
+	void swap_blocks(UnrolledList& other) noexcept;
+
+	[[no_unique_address]] BlockAlloc _alloc;
+	NodeBase _sentinel;
+	size_t _size;
+
+#pragma endregion
+
+public:
+
+#pragma region Iterator
+
+	class iterator
+	{
+	public:
+		using value_type = T;
+		using difference_type = std::ptrdiff_t;
+		using pointer = T*;
+		using reference = T&;
+		using iterator_category = std::bidirectional_iterator_tag;
+
+	private:
+		NodeBase* _node;
+		size_t _index;
+
+	public:
+		iterator(NodeBase* node = nullptr, size_t index = 0);
+
+		reference operator*() const;
+		pointer operator->() const;
+		iterator& operator++();
+		iterator operator++(int);
+		iterator& operator--();
+		iterator operator--(int);
+		bool operator==(const iterator& other) const;
+		bool operator!=(const iterator& other) const;
+
+		friend class const_iterator;
+		friend class UnrolledList;
+	};
+
+	static_assert(std::bidirectional_iterator<iterator>);
+
+#pragma endregion
+
+#pragma region Const Iterator
+
+	class const_iterator
+	{
+	public:
+		using value_type = T;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const T*;
+		using reference = const T&;
+		using iterator_category = std::bidirectional_iterator_tag;
+
+	private:
+		const NodeBase* _node;
+		size_t _index;
+
+	public:
+		const_iterator(const NodeBase* node = nullptr, size_t index = 0);
+		const_iterator(const iterator& iter);
+
+		reference operator*() const;
+		pointer operator->() const;
+		const_iterator& operator++();
+		const_iterator operator++(int);
+		const_iterator& operator--();
+		const_iterator operator--(int);
+		bool operator==(const const_iterator& other) const;
+		bool operator!=(const const_iterator& other) const;
+
+		friend class UnrolledList;
+	};
+
+	static_assert(std::bidirectional_iterator<const_iterator>);
+
+#pragma endregion
+
+	using reverse_iterator = std::reverse_iterator<iterator>;
+	using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+	UnrolledList() noexcept(noexcept(Alloc()));
+	explicit UnrolledList(const Alloc& alloc) noexcept;
+	UnrolledList(std::initializer_list<T> initList, const Alloc& alloc = Alloc());
+	template <std::input_iterator iter>
+	UnrolledList(iter begin, iter end, const Alloc& alloc = Alloc());
+	UnrolledList(const UnrolledList& other);
+	UnrolledList(UnrolledList&& other) noexcept;
+	~UnrolledList();
+
+	allocator_type get_allocator() const;
+
+	bool empty() const noexcept;
+	size_t size() const noexcept;
+	T& front();
+	const T& front() const;
+	T& back();
+	const T& back() const;
+	void clear();
+
+	void push_front(const T& val);
+	void push_back(const T& val);
+	template <typename... Args>
+	T& emplace_back(Args&&... args);
+	void pop_front();
+	void pop_back();
+	template <typename... Args>
+	iterator emplace(const const_iterator& pos, Args&&... args);
+	iterator insert(const const_iterator& pos, const T& val);
+	iterator insert(const const_iterator& pos, T&& val);
+	iterator erase(const const_iterator& pos);
+	void swap(UnrolledList& other);
+
+	iterator begin();
+	iterator end();
+	const_iterator begin() const;
+	const_iterator end() const;
+	const_iterator cbegin() const;
+	const_iterator cend() const;
+	reverse_iterator rbegin();
+	reverse_iterator rend();
+	const_reverse_iterator rbegin() const;
+	const_reverse_iterator rend() const;
+	const_reverse_iterator crbegin() const;
+	const_reverse_iterator crend() const;
+
+	UnrolledList& operator=(const UnrolledList& other);
+	UnrolledList& operator=(UnrolledList&& other) noexcept(AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value);
+
+	template <typename U, size_t N, typename A>
+	friend bool operator==(const UnrolledList<U, N, A>& lhs, const UnrolledList<U, N, A>& rhs);
+
+};
+
+#pragma region CtorsAndDestructors
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::UnrolledList() noexcept(noexcept(Alloc())) : UnrolledList(Alloc()) { }
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::UnrolledList(const Alloc& alloc) noexcept : _alloc(alloc), _sentinel(&_sentinel, &_sentinel), _size(0) { }
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::UnrolledList(std::initializer_list<T> initList, const Alloc& alloc)
+	: UnrolledList(initList.begin(), initList.end(), alloc) { }
+
+template<typename T, size_t K, typename Alloc>
+template<std::input_iterator iter>
+UnrolledList<T, K, Alloc>::UnrolledList(iter begin, iter end, const Alloc& alloc) : UnrolledList(alloc)
+{
+	for (auto it = begin; it != end; ++it)
+		emplace_back(*it);
+}
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::UnrolledList(const UnrolledList& other)
+	: UnrolledList(other.begin(), other.end(), AllocTraits::select_on_container_copy_construction(other.get_allocator())) { }
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::UnrolledList(UnrolledList&& other) noexcept : UnrolledList(other.get_allocator())
+{
+	swap_blocks(other);
+}
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::~UnrolledList()
+{
+	clear();
+}
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::allocator_type UnrolledList<T, K, Alloc>::get_allocator() const
+{
+	return allocator_type(_alloc);
+}
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::NodeBase::NodeBase(NodeBase* next, NodeBase* prev) : _next(next), _prev(prev) { }
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::Block::Block(NodeBase* next, NodeBase* prev) : NodeBase(next, prev), _count(0) { }
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::Block::~Block() { }
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::iterator::iterator(NodeBase* node, size_t index) : _node(node), _index(index) { }
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::const_iterator::const_iterator(const NodeBase* node, size_t index) : _node(node), _index(index) { }
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::const_iterator::const_iterator(const iterator& iter) : _node(iter._node), _index(iter._index) { }
+
+#pragma endregion
+
+#pragma region Block
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::Block* UnrolledList<T, K, Alloc>::block(NodeBase* node)
+{
+	return static_cast<Block*>(node);
+}
+
+template<typename T, size_t K, typename Alloc>
+const UnrolledList<T, K, Alloc>::Block* UnrolledList<T, K, Alloc>::block(const NodeBase* node)
+{
+	return static_cast<const Block*>(node);
+}
+
+// Allocates an empty block and links it in between prev and next.
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::Block* UnrolledList<T, K, Alloc>::create_block(NodeBase* next, NodeBase* prev)
+{
+	Block* newBlock = BlockTraits::allocate(_alloc, 1);
+	::new (static_cast<void*>(newBlock)) Block(next, prev);
+
+	prev->_next = newBlock;
+	next->_prev = newBlock;
+	return newBlock;
+}
+
+// Destroys the remaining elements of a block, unlinks it and frees it.
+template<typename T, size_t K, typename Alloc>
+void UnrolledList<T, K, Alloc>::destroy_block(NodeBase* node)
+{
+	Block* target = block(node);
+	for (size_t i = 0; i < target->_count; ++i)
+		BlockTraits::destroy(_alloc, std::addressof(target->_vals[i]));
+
+	node->_prev->_next = node->_next;
+	node->_next->_prev = node->_prev;
+
+	target->~Block();
+	BlockTraits::deallocate(_alloc, target, 1);
+}
+
+template<typename T, size_t K, typename Alloc>
+template<typename... Args>
+void UnrolledList<T, K, Alloc>::construct_at(Block* target, size_t index, Args&&... args)
+{
+	BlockTraits::construct(_alloc, std::addressof(target->_vals[index]), std::forward<Args>(args)...);
+}
+
+// Moves one element into an empty slot and destroys the source. Only used for
+// shifts within a block, and only when T's move constructor cannot throw.
+template<typename T, size_t K, typename Alloc>
+void UnrolledList<T, K, Alloc>::relocate(Block* from, size_t fromIndex, Block* to, size_t toIndex)
+{
+	construct_at(to, toIndex, std::move(from->_vals[fromIndex]));
+	BlockTraits::destroy(_alloc, std::addressof(from->_vals[fromIndex]));
+}
+
+// Appends the elements [first, last) of from to another block, moving them only
+// if that cannot throw. The sources are left for the caller to destroy. If a copy
+// throws, the elements already appended are destroyed again, so both blocks are
+// as they were.
+template<typename T, size_t K, typename Alloc>
+void UnrolledList<T, K, Alloc>::transfer(Block* from, size_t first, size_t last, Block* to)
+{
+	const size_t start = to->_count;
+
+	try
+	{
+		for (size_t i = first; i < last; ++i)
+		{
+			construct_at(to, to->_count, std::move_if_noexcept(from->_vals[i]));
+			++to->_count;
+		}
+	}
+	catch (...)
+	{
+		while (to->_count > start)
+			BlockTraits::destroy(_alloc, std::addressof(to->_vals[--to->_count]));
+
+		throw;
+	}
+}
+
+// Moves the upper half of a full block into a new block right after it.
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::Block* UnrolledList<T, K, Alloc>::split(Block* full)
+{
+	Block* upper = create_block(full->_next, full);
+
+	const size_t keep = K / 2;
+	try
+	{
+		transfer(full, keep, K, upper);
+	}
+	catch (...)
+	{
+		destroy_block(upper);
+		throw;
+	}
+
+	for (size_t i = keep; i < K; ++i)
+		BlockTraits::destroy(_alloc, std::addressof(full->_vals[i]));
+
+	full->_count = keep;
+	return upper;
+}
+
+// Appends the elements of the following block to target and frees that block.
+template<typename T, size_t K, typename Alloc>
+void UnrolledList<T, K, Alloc>::merge_next(Block* target)
+{
+	Block* next = block(target->_next);
+	transfer(next, 0, next->_count, target);
+	destroy_block(next);
+}
+
+template<typename T, size_t K, typename Alloc>
+void UnrolledList<T, K, Alloc>::swap_blocks(UnrolledList& other) noexcept
+{
+	std::swap(_sentinel._next, other._sentinel._next);
+	std::swap(_sentinel._prev, other._sentinel._prev);
+	std::swap(_size, other._size);
+
+	for (UnrolledList* lst : { this, &other })
+	{
+		if (lst->_size == 0)
+			lst->_sentinel._next = lst->_sentinel._prev = &lst->_sentinel;
+		else
+			lst->_sentinel._next->_prev = lst->_sentinel._prev->_next = &lst->_sentinel;
+	}
+}
+
+#pragma endregion
+
+#pragma region GetElement
+
+template<typename T, size_t K, typename Alloc>
+bool UnrolledList<T, K, Alloc>::empty() const noexcept
+{
+	return _size == 0;
+}
+
+template<typename T, size_t K, typename Alloc>
+size_t UnrolledList<T, K, Alloc>::size() const noexcept
+{
+	return _size;
+}
+
+template<typename T, size_t K, typename Alloc>
+T& UnrolledList<T, K, Alloc>::front()
+{
+	return block(_sentinel._next)->_vals[0];
+}
+
+template<typename T, size_t K, typename Alloc>
+const T& UnrolledList<T, K, Alloc>::front() const
+{
+	return block(_sentinel._next)->_vals[0];
+}
+
+template<typename T, size_t K, typename Alloc>
+T& UnrolledList<T, K, Alloc>::back()
+{
+	Block* last = block(_sentinel._prev);
+	return last->_vals[last->_count - 1];
+}
+
+template<typename T, size_t K, typename Alloc>
+const T& UnrolledList<T, K, Alloc>::back() const
+{
+	const Block* last = block(_sentinel._prev);
+	return last->_vals[last->_count - 1];
+}
+
+#pragma endregion
+
+#pragma region Xary
+
+template<typename T, size_t K, typename Alloc>
+void UnrolledList<T, K, Alloc>::clear()
+{
+	while (_sentinel._next != &_sentinel)
+		destroy_block(_sentinel._next);
+
+	_size = 0;
+}
+
+template<typename T, size_t K, typename Alloc>
+void UnrolledList<T, K, Alloc>::push_front(const T& val)
+{
+	emplace(begin(), val);
+}
+
+template<typename T, size_t K, typename Alloc>
+void UnrolledList<T, K, Alloc>::push_back(const T& val)
+{
+	emplace_back(val);
+}
+
+template<typename T, size_t K, typename Alloc>
+template<typename... Args>
+T& UnrolledList<T, K, Alloc>::emplace_back(Args&&... args)
+{
+	Block* last = _sentinel._prev != &_sentinel ? block(_sentinel._prev) : nullptr;
+	if (last == nullptr || last->_count == K)
+		last = create_block(&_sentinel, _sentinel._prev);
+
+	construct_at(last, last->_count, std::forward<Args>(args)...);
+	++last->_count;
+	++_size;
+
+	return last->_vals[last->_count - 1];
+}
+
+template<typename T, size_t K, typename Alloc>
+void UnrolledList<T, K, Alloc>::pop_front()
+{
+	if (_size != 0)
+		erase(begin());
+}
+
+template<typename T, size_t K, typename Alloc>
+void UnrolledList<T, K, Alloc>::pop_back()
+{
+	if (_size != 0)
+		erase(--end());
+}
+
+// The new value is built before any element shifts, so args may refer to an
+// element of this list.
+template<typename T, size_t K, typename Alloc>
+template<typename... Args>
+UnrolledList<T, K, Alloc>::iterator UnrolledList<T, K, Alloc>::emplace(const const_iterator& pos, Args&&... args)
+{
+	NodeBase* node = const_cast<NodeBase*>(pos._node);
+	size_t index = pos._index;
+
+	if (node == &_sentinel)
+	{
+		emplace_back(std::forward<Args>(args)...);
+		return iterator(_sentinel._prev, block(_sentinel._prev)->_count - 1);
+	}
+
+	T val(std::forward<Args>(args)...);
+
+	Block* target = block(node);
+	if (target->_count == K)
+	{
+		Block* upper = split(target);
+		if (index > target->_count)
+		{
+			index -= target->_count;
+			target = upper;
+		}
+	}
+
+	if constexpr (!std::is_nothrow_move_constructible_v<T>)
+	{
+		Block* fresh = create_block(target, target->_prev);
+		try
+		{
+			transfer(target, 0, index, fresh);
+			construct_at(fresh, index, std::move_if_noexcept(val));
+			++fresh->_count;
+			transfer(target, index, target->_count, fresh);
+		}
+		catch (...)
+		{
+			destroy_block(fresh);
+			throw;
+		}
+
+		destroy_block(target);
+		++_size;
+		return iterator(fresh, index);
+	}
+
+	for (size_t i = target->_count; i > index; --i)
+		relocate(target, i - 1, target, i);
+
+	construct_at(target, index, std::move(val));
+	++target->_count;
+	++_size;
+
+	return iterator(target, index);
+}
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::iterator UnrolledList<T, K, Alloc>::insert(const const_iterator& pos, const T& val)
+{
+	return emplace(pos, val);
+}
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::iterator UnrolledList<T, K, Alloc>::insert(const const_iterator& pos, T&& val)
+{
+	return emplace(pos, std::move(val));
+}
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::iterator UnrolledList<T, K, Alloc>::erase(const const_iterator& pos)
+{
+	Block* target = block(const_cast<NodeBase*>(pos._node));
+	size_t index = pos._index;
+
+	if (!std::is_nothrow_move_constructible_v<T> && index + 1 < target->_count)
+	{
+		Block* fresh = create_block(target, target->_prev);
+		try
+		{
+			transfer(target, 0, index, fresh);
+			transfer(target, index + 1, target->_count, fresh);
+		}
+		catch (...)
+		{
+			destroy_block(fresh);
+			throw;
+		}
+
+		destroy_block(target);
+		target = fresh;
+	}
+	else
+	{
+		BlockTraits::destroy(_alloc, std::addressof(target->_vals[index]));
+		for (size_t i = index + 1; i < target->_count; ++i)
+			relocate(target, i, target, i - 1);
+
+		--target->_count;
+	}
+
+	--_size;
+
+	if (target->_count == 0)
+	{
+		NodeBase* next = target->_next;
+		destroy_block(target);
+		return iterator(next, 0);
+	}
+
+	// Merging only saves space, so if copying an element throws the blocks stay apart.
+	if (target->_count < K / 4 && target->_next != &_sentinel && target->_count + block(target->_next)->_count <= K / 2)
+	{
+		try
+		{
+			merge_next(target);
+		}
+		catch (...)
+		{
+		}
+	}
+
+	if (index == target->_count)
+		return iterator(target->_next, 0);
+
+	return iterator(target, index);
+}
+
+template<typename T, size_t K, typename Alloc>
+void UnrolledList<T, K, Alloc>::swap(UnrolledList& other)
+{
+	if constexpr (AllocTraits::propagate_on_container_swap::value)
+	{
+		using std::swap;
+		swap(_alloc, other._alloc);
+	}
+	else if (!AllocTraits::is_always_equal::value && _alloc != other._alloc)
+	{
+		// Each list keeps its allocator and its blocks: the common prefix swaps
+		// values, and the longer list's surplus is moved over element by element.
+		UnrolledList& longer = _size > other._size ? *this : other;
+		UnrolledList& shorter = _size > other._size ? other : *this;
+		size_t common = shorter._size;
+
+		iterator curr = begin();
+		iterator otherCurr = other.begin();
+		for (size_t i = 0; i < common; ++i, ++curr, ++otherCurr)
+		{
+			using std::swap;
+			swap(*curr, *otherCurr);
+		}
+
+		try
+		{
+			for (iterator it = &longer == this ? curr : otherCurr; it != longer.end(); ++it)
+				shorter.emplace_back(std::move(*it));
+		}
+		catch (...)
+		{
+			while (shorter._size > common)
+				shorter.pop_back();
+			throw;
+		}
+
+		while (longer._size > common)
+			longer.pop_back();
+
+		return;
+	}
+
+	swap_blocks(other);
+}
+
+#pragma endregion
+
+#pragma region Operators
+
+template<typename T, size_t K, typename Alloc>
+bool operator==(const UnrolledList<T, K, Alloc>& lhs, const UnrolledList<T, K, Alloc>& rhs)
+{
+	if (lhs._size != rhs._size)
+		return false;
+
+	auto rhsIter = rhs.begin();
+	for (const T& val : lhs)
+	{
+		if (!(val == *rhsIter))
+			return false;
+
+		++rhsIter;
+	}
+
+	return true;
+}
+
+template<typename T, size_t K, typename Alloc>
+bool operator!=(const UnrolledList<T, K, Alloc>& lhs, const UnrolledList<T, K, Alloc>& rhs)
+{
+	return !(lhs == rhs);
+}
+
+template<typename T, size_t K, typename Alloc>
+void swap(UnrolledList<T, K, Alloc>& lhs, UnrolledList<T, K, Alloc>& rhs)
+{
+	lhs.swap(rhs);
+}
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>& UnrolledList<T, K, Alloc>::operator=(const UnrolledList& other)
+{
+	if (this == &other) return *this;
+
+	clear();
+
+	if constexpr (AllocTraits::propagate_on_container_copy_assignment::value)
+		_alloc = other._alloc;
+
+	for (const T& val : other)
+		emplace_back(val);
+
+	return *this;
+}
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>& UnrolledList<T, K, Alloc>::operator=(UnrolledList&& other) noexcept(AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value)
+{
+	if (this == &other) return *this;
+
+	clear();
+
+	if constexpr (AllocTraits::propagate_on_container_move_assignment::value)
+	{
+		using std::swap;
+		swap(_alloc, other._alloc);
+	}
+	else if (!AllocTraits::is_always_equal::value && _alloc != other._alloc)
+	{
+		for (T& val : other)
+			emplace_back(std::move(val));
+
+		other.clear();
+		return *this;
+	}
+
+	swap_blocks(other);
+	return *this;
+}
+
+#pragma endregion
+
+#pragma region Iterator
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::iterator UnrolledList<T, K, Alloc>::begin()
+{
+	return iterator(_sentinel._next, 0);
+}
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::iterator UnrolledList<T, K, Alloc>::end()
+{
+	return iterator(&_sentinel, 0);
+}
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::iterator::reference UnrolledList<T, K, Alloc>::iterator::operator*() const
+{
+	return block(_node)->_vals[_index];
+}
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::iterator::pointer UnrolledList<T, K, Alloc>::iterator::operator->() const
+{
+	return std::addressof(block(_node)->_vals[_index]);
+}
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::iterator& UnrolledList<T, K, Alloc>::iterator::operator++()
+{
+	if (++_index == block(_node)->_count)
+	{
+		_node = _node->_next;
+		_index = 0;
+	}
+
+	return *this;
+}
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::iterator UnrolledList<T, K, Alloc>::iterator::operator++(int)
+{
+	iterator result(*this);
+	++(*this);
+	return result;
+}
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::iterator& UnrolledList<T, K, Alloc>::iterator::operator--()
+{
+	if (_index == 0)
+	{
+		_node = _node->_prev;
+		_index = block(_node)->_count;
+	}
+
+	--_index;
+	return *this;
+}
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::iterator UnrolledList<T, K, Alloc>::iterator::operator--(int)
+{
+	iterator result(*this);
+	--(*this);
+	return result;
+}
+
+template<typename T, size_t K, typename Alloc>
+bool UnrolledList<T, K, Alloc>::iterator::operator==(const iterator& other) const
+{
+	return _node == other._node && _index == other._index;
+}
+
+template<typename T, size_t K, typename Alloc>
+bool UnrolledList<T, K, Alloc>::iterator::operator!=(const iterator& other) const
+{
+	return !(*this == other);
+}
+
+#pragma endregion
+
+#pragma region Const Iterator
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::const_iterator UnrolledList<T, K, Alloc>::begin() const
+{
+	return const_iterator(_sentinel._next, 0);
+}
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::const_iterator UnrolledList<T, K, Alloc>::end() const
+{
+	return const_iterator(&_sentinel, 0);
+}
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::const_iterator UnrolledList<T, K, Alloc>::cbegin() const
+{
+	return begin();
+}
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::const_iterator UnrolledList<T, K, Alloc>::cend() const
+{
+	return end();
+}
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::const_iterator::reference UnrolledList<T, K, Alloc>::const_iterator::operator*() const
+{
+	return block(_node)->_vals[_index];
+}
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::const_iterator::pointer UnrolledList<T, K, Alloc>::const_iterator::operator->() const
+{
+	return std::addressof(block(_node)->_vals[_index]);
+}
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::const_iterator& UnrolledList<T, K, Alloc>::const_iterator::operator++()
+{
+	if (++_index == block(_node)->_count)
+	{
+		_node = _node->_next;
+		_index = 0;
+	}
+
+	return *this;
+}
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::const_iterator UnrolledList<T, K, Alloc>::const_iterator::operator++(int)
+{
+	const_iterator result(*this);
+	++(*this);
+	return result;
+}
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::const_iterator& UnrolledList<T, K, Alloc>::const_iterator::operator--()
+{
+	if (_index == 0)
+	{
+		_node = _node->_prev;
+		_index = block(_node)->_count;
+	}
+
+	--_index;
+	return *this;
+}
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::const_iterator UnrolledList<T, K, Alloc>::const_iterator::operator--(int)
+{
+	const_iterator result(*this);
+	--(*this);
+	return result;
+}
+
+template<typename T, size_t K, typename Alloc>
+bool UnrolledList<T, K, Alloc>::const_iterator::operator==(const const_iterator& other) const
+{
+	return _node == other._node && _index == other._index;
+}
+
+template<typename T, size_t K, typename Alloc>
+bool UnrolledList<T, K, Alloc>::const_iterator::operator!=(const const_iterator& other) const
+{
+	return !(*this == other);
+}
+
+#pragma endregion
+
+#pragma region Reverse Iterator
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::reverse_iterator UnrolledList<T, K, Alloc>::rbegin()
+{
+	return reverse_iterator(end());
+}
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::reverse_iterator UnrolledList<T, K, Alloc>::rend()
+{
+	return reverse_iterator(begin());
+}
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::const_reverse_iterator UnrolledList<T, K, Alloc>::rbegin() const
+{
+	return const_reverse_iterator(end());
+}
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::const_reverse_iterator UnrolledList<T, K, Alloc>::rend() const
+{
+	return const_reverse_iterator(begin());
+}
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::const_reverse_iterator UnrolledList<T, K, Alloc>::crbegin() const
+{
+	return rbegin();
+}
+
+template<typename T, size_t K, typename Alloc>
+UnrolledList<T, K, Alloc>::const_reverse_iterator UnrolledList<T, K, Alloc>::crend() const
+{
+	return rend();
+}
+
+#pragma endregion
@@ -20,6 +20,25 @@
 #include "Tests/20MergeTest.h"
 #include "Tests/21SortTest.h"
 #include "Tests/22StlCompatibilityTest.h"
+#include "Tests/23AllocatorTest.h"
+#include "Tests/24PoolAllocatorTest.h"
+#include "Tests/25SpliceTest.h"
+#include "Tests/26MoveSemanticsTest.h"
+#include "Tests/27EmplaceTest.h"
+#include "Tests/28BulkInsertTest.h"
+#include "Tests/29UnrolledListTest.h"
+#include "Tests/30ArenaListTest.h"
+#include "Tests/31IntrusiveListTest.h"
+#include "Tests/32ForwardListTest.h"
+#include "Tests/33SmallListTest.h"
+#include "Tests/34ParallelSortTest.h"
+#include "Tests/35ParallelTraversalTest.h"
+#include "Tests/36StatsAllocatorTest.h"
+#include "Tests/37AllocationBudgetTest.h"
+#include "Tests/38PrefetchTraversalTest.h"
+#include "Tests/39DefragmentTest.h"
+#include "Tests/40BulkRemoveTest.h"
+#include "Tests/41IndexedListTest.h"
 
 #include <iostream>
 